@@ -27,6 +27,9 @@ public class ActorTurnInPlace : ModuleRules
 			}
 			);
 		
+		// Iris replication, @see FTurnInPlaceSimulatedReplicationNetSerializer
+		SetupIrisSupport(Target);
+		
 		if (Target.bBuildEditor)
 		{
 			PrivateDependencyModuleNames.AddRange(
@@ -2,6 +2,8 @@
 
 #include "ActorTurnInPlace.h"
 
+#include "TurnInPlaceCurveTable.h"
+
 #define LOCTEXT_NAMESPACE "FActorTurnInPlaceModule"
 
 void FActorTurnInPlaceModule::StartupModule()
@@ -13,6 +15,7 @@ void FActorTurnInPlaceModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FTurnInPlaceCurveTableCache::Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
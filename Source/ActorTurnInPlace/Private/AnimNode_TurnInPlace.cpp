@@ -0,0 +1,124 @@
+﻿// Copyright (c) 2025 Jared Taylor
+
+
+#include "AnimNode_TurnInPlace.h"
+
+#include "TurnInPlaceStatics.h"
+#include "Animation/AnimSequence.h"
+#include "Animation/AnimInstanceProxy.h"
+#include "Animation/AnimTrace.h"
+#include "AnimationRuntime.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AnimNode_TurnInPlace)
+
+void FAnimNode_TurnInPlace::Initialize_AnyThread(const FAnimationInitializeContext& Context)
+{
+	FAnimNode_Base::Initialize_AnyThread(Context);
+	GetEvaluateGraphExposedInputs().Execute(Context);
+
+	Source.Initialize(Context);
+
+	ResetState();
+	NodeData = FTurnInPlaceGraphNodeData();
+	Anim = nullptr;
+	TurnBlend.SetBlendOption(BlendOption);
+	TurnBlend.SetValueRange(0.f, 0.f);
+	TurnBlend.SetBlendTime(0.f);
+	TurnBlend.Reset();
+}
+
+void FAnimNode_TurnInPlace::CacheBones_AnyThread(const FAnimationCacheBonesContext& Context)
+{
+	Source.CacheBones(Context);
+}
+
+void FAnimNode_TurnInPlace::Update_AnyThread(const FAnimationUpdateContext& Context)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FAnimNode_TurnInPlace::Update_AnyThread);
+
+	GetEvaluateGraphExposedInputs().Execute(Context);
+
+	const float DeltaTime = Context.GetDeltaTime();
+
+	// The dedicated server steps the pseudo anim state instead, don't play turns twice
+	if (AnimGraphData.bWantsPseudoAnimState)
+	{
+		ResetState();
+	}
+	else if (bCanUpdateTurnInPlace)
+	{
+		// Identical to the pseudo anim state so the server and client can't drift
+		UTurnInPlaceStatics::ThreadSafeUpdatePseudoAnimState(DeltaTime, AnimGraphData, AnimGraphData.bIsStrafing, TurnOutput, State, NodeData, Anim);
+	}
+
+	// Blend the turn animation in while turning and recovering, and back out when returning to idle
+	const float DesiredWeight = State != ETurnPseudoAnimState::Idle && Anim ? 1.f : 0.f;
+	if (!FMath::IsNearlyEqual(TurnBlend.GetDesiredValue(), DesiredWeight))
+	{
+		TurnBlend.SetBlendOption(BlendOption);
+		TurnBlend.SetValueRange(TurnBlend.GetBlendedValue(), DesiredWeight);
+		TurnBlend.SetBlendTime(BlendTime);
+	}
+	TurnBlend.Update(DeltaTime);
+
+	const float TurnWeight = TurnBlend.GetBlendedValue();
+	Source.Update(Context.FractionalWeight(1.f - TurnWeight));
+
+	TRACE_ANIM_NODE_VALUE(Context, TEXT("State"), *UEnum::GetValueAsString(State));
+	TRACE_ANIM_NODE_VALUE(Context, TEXT("Anim"), Anim ? *Anim->GetName() : TEXT("None"));
+	TRACE_ANIM_NODE_VALUE(Context, TEXT("Time"), NodeData.AnimStateTime);
+	TRACE_ANIM_NODE_VALUE(Context, TEXT("Play Rate"), NodeData.TurnPlayRate);
+	TRACE_ANIM_NODE_VALUE(Context, TEXT("Turn Weight"), TurnWeight);
+}
+
+void FAnimNode_TurnInPlace::Evaluate_AnyThread(FPoseContext& Output)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FAnimNode_TurnInPlace::Evaluate_AnyThread);
+
+	const float TurnWeight = Anim ? TurnBlend.GetBlendedValue() : 0.f;
+	if (!FAnimWeight::IsRelevant(TurnWeight))
+	{
+		Source.Evaluate(Output);
+		return;
+	}
+
+	// Anim time is driven by the turn state, not by a sequence player
+	const FAnimExtractContext ExtractContext(NodeData.AnimStateTime, false);
+
+	if (FAnimWeight::IsFullWeight(TurnWeight))
+	{
+		FAnimationPoseData OutputPoseData(Output);
+		Anim->GetAnimationPose(OutputPoseData, ExtractContext);
+		return;
+	}
+
+	FPoseContext SourcePose(Output);
+	Source.Evaluate(SourcePose);
+
+	FPoseContext TurnPose(Output);
+	FAnimationPoseData TurnPoseData(TurnPose);
+	Anim->GetAnimationPose(TurnPoseData, ExtractContext);
+
+	FAnimationPoseData OutputPoseData(Output);
+	FAnimationRuntime::BlendTwoPosesTogether(FAnimationPoseData(SourcePose), TurnPoseData, 1.f - TurnWeight, OutputPoseData);
+}
+
+void FAnimNode_TurnInPlace::GatherDebugData(FNodeDebugData& DebugData)
+{
+	FString DebugLine = DebugData.GetNodeName(this);
+	DebugLine += FString::Printf(TEXT("(State: %s, Anim: %s, Time: %.2f, Play Rate: %.2f, Turn Weight: %.2f)"),
+		*UEnum::GetValueAsString(State), *GetNameSafe(Anim), NodeData.AnimStateTime, NodeData.TurnPlayRate,
+		TurnBlend.GetBlendedValue());
+	DebugData.AddDebugItem(DebugLine);
+
+	Source.GatherDebugData(DebugData);
+}
+
+void FAnimNode_TurnInPlace::ResetState()
+{
+	// Same as SetupIdle() in StepPseudoAnimState, the anim and its time are kept so the turn can blend out
+	State = ETurnPseudoAnimState::Idle;
+	NodeData.TurnPlayRate = 1.f;
+	NodeData.bHasReachedMaxTurnAngle = false;
+	TurnOutput = FTurnInPlaceAnimGraphOutput();
+}
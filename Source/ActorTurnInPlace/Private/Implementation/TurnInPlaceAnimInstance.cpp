@@ -0,0 +1,103 @@
+﻿// Copyright (c) 2025 Jared Taylor
+
+
+#include "Implementation/TurnInPlaceAnimInstance.h"
+
+#include "TurnInPlace.h"
+#include "TurnInPlaceAnimSetAsset.h"
+#include "TurnInPlaceStatics.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(TurnInPlaceAnimInstance)
+
+void UTurnInPlaceAnimInstance::SetTurnInPlaceAnimSet(const FTurnInPlaceAnimSet& InAnimSet)
+{
+	TurnInPlaceAnimSet = InAnimSet;
+	if (IsValid(TurnInPlace))
+	{
+		TurnInPlace->NotifyAnimSetChanged();
+	}
+}
+
+bool UTurnInPlaceAnimInstance::IsInterfaceImplementedInScript(const UClass* AnimClass)
+{
+	if (!AnimClass)
+	{
+		return false;
+	}
+	
+	return AnimClass->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(ITurnInPlaceAnimInterface, GetTurnInPlaceAnimSet)) ||
+		AnimClass->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(ITurnInPlaceAnimInterface, GetTurnInPlaceCurveValues)) ||
+		AnimClass->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(ITurnInPlaceAnimInterface, GetTurnInPlaceAnimSetAsset));
+}
+
+bool UTurnInPlaceAnimInstance::IsStrafing() const
+{
+	const ACharacter* Character = Cast<ACharacter>(GetOwningActor());
+	return Character && Character->GetCharacterMovement() && !Character->GetCharacterMovement()->bOrientRotationToMovement;
+}
+
+void UTurnInPlaceAnimInstance::NativeInitializeAnimation()
+{
+	Super::NativeInitializeAnimation();
+
+	const AActor* OwningActor = GetOwningActor();
+	TurnInPlace = OwningActor ? OwningActor->FindComponentByClass<UTurnInPlace>() : nullptr;
+	bPublishTurnCurveValues = !IsInterfaceImplementedInScript(GetClass());
+}
+
+void UTurnInPlaceAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlaceAnimInstance::NativeUpdateAnimation);
+	
+	Super::NativeUpdateAnimation(DeltaSeconds);
+
+	bUpdateTurnInPlaceFromInputs = false;
+	if (!bNativeTurnInPlaceUpdate)
+	{
+		return;
+	}
+
+	// The pseudo anim state is advanced by the component, which can only happen here unless it is batched
+	bUpdateTurnInPlaceFromInputs = bThreadSafeTurnInPlaceUpdate && IsValid(TurnInPlace) &&
+		(!TurnInPlace->WantsPseudoAnimState() || TurnInPlace->IsPseudoAnimStateBatched());
+	if (bUpdateTurnInPlaceFromInputs)
+	{
+		// The movement update may not have captured the inputs this frame
+		TurnInPlace->CaptureAnimGraphInputsIfStale();
+		return;
+	}
+
+	bIsStrafing = IsStrafing();
+	UTurnInPlaceStatics::UpdateTurnInPlace(TurnInPlace, DeltaSeconds, TurnAnimGraphData, bIsStrafing,
+		TurnAnimGraphOutput, bCanUpdateTurnInPlace);
+}
+
+void UTurnInPlaceAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlaceAnimInstance::NativeThreadSafeUpdateAnimation);
+	
+	Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+
+	if (!bNativeTurnInPlaceUpdate)
+	{
+		return;
+	}
+
+	if (bUpdateTurnInPlaceFromInputs)
+	{
+		const FTurnInPlaceAnimGraphInputs& Inputs = TurnInPlace->GetAnimGraphInputs();
+		bIsStrafing = Inputs.bIsStrafing;
+		UTurnInPlaceStatics::ThreadSafeUpdateTurnInPlaceFromInputs(Inputs, TurnAnimGraphData, bCanUpdateTurnInPlace, TurnAnimGraphOutput);
+	}
+	else
+	{
+		UTurnInPlaceStatics::ThreadSafeUpdateTurnInPlace(TurnAnimGraphData, bCanUpdateTurnInPlace, bIsStrafing, TurnAnimGraphOutput);
+	}
+	TurnCurveValues = UTurnInPlaceStatics::ThreadSafeUpdateTurnInPlaceCurveValues(this, TurnAnimGraphData);
+	if (bPublishTurnCurveValues)
+	{
+		UTurnInPlaceStatics::ThreadSafePublishTurnInPlaceCurveValues(TurnInPlace, TurnCurveValues);
+	}
+}
@@ -8,6 +8,8 @@
 #include "Implementation/TurnInPlaceMovement.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/World.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "TurnInPlaceStatics.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(TurnInPlaceCharacter)
@@ -77,6 +79,64 @@ void ATurnInPlaceCharacter::FaceRotation(FRotator NewControlRotation, float Delt
 	}
 }
 
+void ATurnInPlaceCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	// Push Model
+	FDoRepLifetimeParams SharedParams;
+	SharedParams.bIsPushBased = true;
+	SharedParams.Condition = bReplicateTurnOffsetWithCharacter ? COND_SimulatedOnly : COND_Never;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, ReplicatedTurnOffset, SharedParams);
+}
+
+void ATurnInPlaceCharacter::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	// We replicate the turn offset ourselves, the component doesn't need to replicate at all
+	if (bReplicateTurnOffsetWithCharacter && TurnInPlace)
+	{
+		TurnInPlace->SetIsReplicated(false);
+	}
+}
+
+void ATurnInPlaceCharacter::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+
+	// Pick up the turn offset compressed by the component during its movement update
+	if (bReplicateTurnOffsetWithCharacter && TurnInPlace)
+	{
+		const FTurnInPlaceSimulatedReplication& SimulatedTurnOffset = TurnInPlace->GetSimulatedTurnOffset();
+		if (SimulatedTurnOffset.TurnOffset != ReplicatedTurnOffset.TurnOffset || SimulatedTurnOffset.RangeCode != ReplicatedTurnOffset.RangeCode)
+		{
+			ReplicatedTurnOffset = SimulatedTurnOffset;
+			MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, ReplicatedTurnOffset, this);
+		}
+	}
+}
+
+void ATurnInPlaceCharacter::OnRep_ReplicatedTurnOffset()
+{
+	if (TurnInPlace)
+	{
+		TurnInPlace->ReceiveSimulatedTurnOffset(ReplicatedTurnOffset);
+	}
+}
+
+void ATurnInPlaceCharacter::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Server no longer needs to tick the pose if turn in place doesn't depend on animation
+	if (GetMesh() && TurnInPlace && TurnInPlace->IsAnimationFree())
+	{
+		GetMesh()->VisibilityBasedAnimTickOption = AnimationFreeServerAnimTickOption;
+	}
+}
+
 void ATurnInPlaceCharacter::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
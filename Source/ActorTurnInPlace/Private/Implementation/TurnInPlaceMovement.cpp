@@ -163,6 +163,22 @@ void UTurnInPlaceMovement::PhysicsRotation(float DeltaTime)
 	}
 }
 
+void UTurnInPlaceMovement::PerformMovement(float DeltaTime)
+{
+	UTurnInPlace* TurnInPlace = GetTurnInPlace();
+	if (!TurnInPlace || !TurnInPlace->HasPendingOwnerRotation())
+	{
+		Super::PerformMovement(DeltaTime);
+		return;
+	}
+
+	// Wrap the movement in our own scope so the deferred rotation and the movement update attached components once
+	// Super::PerformMovement() opens its own scope, which is nested within this one
+	FScopedMovementUpdate ScopedMovementUpdate(UpdatedComponent, bEnableScopedMovementUpdates ? EScopedUpdate::DeferredUpdates : EScopedUpdate::ImmediateUpdates);
+	TurnInPlace->FlushPendingOwnerRotation();
+	Super::PerformMovement(DeltaTime);
+}
+
 class FNetworkPredictionData_Client* UTurnInPlaceMovement::GetPredictionData_Client() const
 {
 	if (ClientPredictionData == nullptr)
@@ -218,6 +234,9 @@ void FSavedMove_Character_TurnInPlace::CombineWith(const FSavedMove_Character* O
 		 */
 		const FSavedMove_Character_TurnInPlace* SavedOldMove = static_cast<const FSavedMove_Character_TurnInPlace*>(OldMove);
 		TurnInPlace->TurnData = SavedOldMove->StartTurnData;
+
+		// Any rotation deferred by bDeferRotationToMovement was based on the rotation we were just reset from
+		TurnInPlace->ClearPendingOwnerRotation();
 	}
 }
 
@@ -0,0 +1,361 @@
+﻿// Copyright (c) 2025 Jared Taylor
+
+
+#include "System/TurnInPlaceNetSerializer.h"
+
+#include "TurnInPlaceTypes.h"
+
+#if UE_WITH_IRIS
+#include "Iris/Serialization/NetBitStreamReader.h"
+#include "Iris/Serialization/NetBitStreamWriter.h"
+#include "Iris/Serialization/NetSerializerDelegates.h"
+#include "Iris/ReplicationState/PropertyNetSerializerInfoRegistry.h"
+#endif
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(TurnInPlaceNetSerializer)
+
+#if UE_WITH_IRIS
+
+namespace UE::Net
+{
+
+struct FTurnInPlaceSimulatedReplicationNetSerializer
+{
+	static constexpr uint32 Version = 1;
+	static constexpr bool bUseDefaultDelta = false;
+
+	/** Bits used by a delta between two values quantized at the same precision and range, zigzag encoded */
+	static constexpr uint32 SmallDeltaBits = 6;
+
+	/** Bits used by the time elapsed between two server times, larger gaps send the full server time */
+	static constexpr uint32 SmallTimeDeltaBits = 10;
+
+	struct FQuantizedType
+	{
+		/** Turn offset compressed to short, as replicated by NetSerialize */
+		uint16 TurnOffset;
+
+		/** Turn offset quantized at Precision, or TurnOffset if Precision is Full */
+		uint16 Value;
+
+		/** Server time the turn offset was sampled at in milliseconds */
+		uint16 ServerTime;
+
+		uint8 RangeCode;
+		uint8 Precision;
+		uint8 bHasServerTime;
+	};
+
+	typedef FTurnInPlaceSimulatedReplication SourceType;
+	typedef FQuantizedType QuantizedType;
+	typedef FTurnInPlaceSimulatedReplicationNetSerializerConfig ConfigType;
+
+	static const ConfigType DefaultConfig;
+
+	static void Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Args);
+	static void Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Args);
+
+	static void SerializeDelta(FNetSerializationContext& Context, const FNetSerializeDeltaArgs& Args);
+	static void DeserializeDelta(FNetSerializationContext& Context, const FNetDeserializeDeltaArgs& Args);
+
+	static void Quantize(FNetSerializationContext& Context, const FNetQuantizeArgs& Args);
+	static void Dequantize(FNetSerializationContext& Context, const FNetDequantizeArgs& Args);
+
+	static bool IsEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Args);
+	static bool Validate(FNetSerializationContext& Context, const FNetValidateArgs& Args);
+
+private:
+	static void WriteValue(FNetBitStreamWriter* Writer, const QuantizedType& Value);
+	static void ReadValue(FNetBitStreamReader* Reader, QuantizedType& Value);
+
+	static void WriteTurnOffset(FNetBitStreamWriter* Writer, const QuantizedType& Value);
+	static void ReadTurnOffset(FNetBitStreamReader* Reader, QuantizedType& Value);
+
+	/** Write the server time, as a small delta from PrevValue when possible */
+	static void WriteServerTime(FNetBitStreamWriter* Writer, const QuantizedType& Value, const QuantizedType* PrevValue);
+	static void ReadServerTime(FNetBitStreamReader* Reader, QuantizedType& Value, const QuantizedType* PrevValue);
+
+	static bool IsEqualQuantized(const QuantizedType& Value0, const QuantizedType& Value1);
+
+	/** Restore TurnOffset from the Value read from the bit stream */
+	static void RestoreTurnOffset(QuantizedType& Value);
+
+	class FNetSerializerRegistryDelegates final : private UE::Net::FNetSerializerRegistryDelegates
+	{
+	public:
+		virtual ~FNetSerializerRegistryDelegates();
+
+	private:
+		virtual void OnPreFreezeNetSerializerRegistry() override;
+	};
+
+	static FTurnInPlaceSimulatedReplicationNetSerializer::FNetSerializerRegistryDelegates NetSerializerRegistryDelegates;
+};
+
+UE_NET_IMPLEMENT_SERIALIZER(FTurnInPlaceSimulatedReplicationNetSerializer);
+
+const FTurnInPlaceSimulatedReplicationNetSerializer::ConfigType FTurnInPlaceSimulatedReplicationNetSerializer::DefaultConfig;
+FTurnInPlaceSimulatedReplicationNetSerializer::FNetSerializerRegistryDelegates FTurnInPlaceSimulatedReplicationNetSerializer::NetSerializerRegistryDelegates;
+
+void FTurnInPlaceSimulatedReplicationNetSerializer::WriteValue(FNetBitStreamWriter* Writer, const QuantizedType& Value)
+{
+	WriteServerTime(Writer, Value, nullptr);
+	WriteTurnOffset(Writer, Value);
+}
+
+void FTurnInPlaceSimulatedReplicationNetSerializer::ReadValue(FNetBitStreamReader* Reader, QuantizedType& Value)
+{
+	Value = QuantizedType();
+	ReadServerTime(Reader, Value, nullptr);
+	ReadTurnOffset(Reader, Value);
+}
+
+void FTurnInPlaceSimulatedReplicationNetSerializer::WriteServerTime(FNetBitStreamWriter* Writer, const QuantizedType& Value,
+	const QuantizedType* PrevValue)
+{
+	// Server time is only sent when simulated proxies extrapolate
+	if (!Writer->WriteBool(Value.bHasServerTime != 0))
+	{
+		return;
+	}
+
+	// Updates are usually a fraction of a second apart, send the elapsed time instead
+	const uint32 Delta = PrevValue && PrevValue->bHasServerTime ? static_cast<uint16>(Value.ServerTime - PrevValue->ServerTime) : MAX_uint32;
+	if (Writer->WriteBool(Delta < (1u << SmallTimeDeltaBits)))
+	{
+		Writer->WriteBits(Delta, SmallTimeDeltaBits);
+		return;
+	}
+
+	Writer->WriteBits(Value.ServerTime, 16U);
+}
+
+void FTurnInPlaceSimulatedReplicationNetSerializer::ReadServerTime(FNetBitStreamReader* Reader, QuantizedType& Value,
+	const QuantizedType* PrevValue)
+{
+	Value.bHasServerTime = Reader->ReadBool() ? 1 : 0;
+	if (!Value.bHasServerTime)
+	{
+		Value.ServerTime = 0;
+		return;
+	}
+
+	// Elapsed time since PrevValue's server time
+	if (Reader->ReadBool())
+	{
+		const uint16 Delta = static_cast<uint16>(Reader->ReadBits(SmallTimeDeltaBits));
+		Value.ServerTime = static_cast<uint16>((PrevValue ? PrevValue->ServerTime : 0) + Delta);
+		return;
+	}
+
+	Value.ServerTime = static_cast<uint16>(Reader->ReadBits(16U));
+}
+
+void FTurnInPlaceSimulatedReplicationNetSerializer::WriteTurnOffset(FNetBitStreamWriter* Writer, const QuantizedType& Value)
+{
+	// Idle is by far the most common state, send it as a single bit
+	if (Writer->WriteBool(Value.TurnOffset == 0))
+	{
+		return;
+	}
+
+	const ETurnNetPrecision Precision = static_cast<ETurnNetPrecision>(Value.Precision);
+	Writer->WriteBits(Value.Precision, 2U);
+	if (Precision != ETurnNetPrecision::Full)
+	{
+		Writer->WriteBits(Value.RangeCode, 2U);
+	}
+	Writer->WriteBits(Value.Value, FTurnInPlaceSimulatedReplication::GetValueBits(Precision));
+}
+
+void FTurnInPlaceSimulatedReplicationNetSerializer::ReadTurnOffset(FNetBitStreamReader* Reader, QuantizedType& Value)
+{
+	Value.TurnOffset = 0;
+	Value.Value = 0;
+	Value.RangeCode = 0;
+	Value.Precision = 0;
+	if (Reader->ReadBool())
+	{
+		return;
+	}
+
+	Value.Precision = static_cast<uint8>(Reader->ReadBits(2U));
+	const ETurnNetPrecision Precision = static_cast<ETurnNetPrecision>(Value.Precision);
+	if (Precision != ETurnNetPrecision::Full)
+	{
+		Value.RangeCode = static_cast<uint8>(Reader->ReadBits(2U));
+	}
+	Value.Value = static_cast<uint16>(Reader->ReadBits(FTurnInPlaceSimulatedReplication::GetValueBits(Precision)));
+	RestoreTurnOffset(Value);
+}
+
+void FTurnInPlaceSimulatedReplicationNetSerializer::RestoreTurnOffset(QuantizedType& Value)
+{
+	const ETurnNetPrecision Precision = static_cast<ETurnNetPrecision>(Value.Precision);
+	if (Precision == ETurnNetPrecision::Full)
+	{
+		Value.TurnOffset = Value.Value;
+		return;
+	}
+
+	const float Range = (Value.RangeCode + 1) * FTurnInPlaceSimulatedReplication::RangeStep;
+	const float Angle = FTurnInPlaceSimulatedReplication::DequantizeAngle(Value.Value, Range,
+		FTurnInPlaceSimulatedReplication::GetValueBits(Precision));
+
+	Value.TurnOffset = FRotator::CompressAxisToShort(Angle);
+}
+
+void FTurnInPlaceSimulatedReplicationNetSerializer::Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Args)
+{
+	const QuantizedType& Value = *reinterpret_cast<const QuantizedType*>(Args.Source);
+	WriteValue(Context.GetBitStreamWriter(), Value);
+}
+
+void FTurnInPlaceSimulatedReplicationNetSerializer::Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Args)
+{
+	QuantizedType& Target = *reinterpret_cast<QuantizedType*>(Args.Target);
+	ReadValue(Context.GetBitStreamReader(), Target);
+}
+
+void FTurnInPlaceSimulatedReplicationNetSerializer::SerializeDelta(FNetSerializationContext& Context, const FNetSerializeDeltaArgs& Args)
+{
+	const QuantizedType& Value = *reinterpret_cast<const QuantizedType*>(Args.Source);
+	const QuantizedType& PrevValue = *reinterpret_cast<const QuantizedType*>(Args.Prev);
+	FNetBitStreamWriter* Writer = Context.GetBitStreamWriter();
+
+	if (Writer->WriteBool(IsEqualQuantized(Value, PrevValue)))
+	{
+		return;
+	}
+
+	WriteServerTime(Writer, Value, &PrevValue);
+
+	// Only the server time changed
+	const bool bSameTurnOffset = Value.TurnOffset == PrevValue.TurnOffset && Value.Value == PrevValue.Value &&
+		Value.RangeCode == PrevValue.RangeCode && Value.Precision == PrevValue.Precision;
+	if (Writer->WriteBool(bSameTurnOffset))
+	{
+		return;
+	}
+
+	// Small changes at the same precision and range only send the difference
+	const bool bComparable = Value.TurnOffset != 0 && PrevValue.TurnOffset != 0 && Value.Precision == PrevValue.Precision &&
+		Value.RangeCode == PrevValue.RangeCode;
+	const int32 Delta = static_cast<int32>(Value.Value) - static_cast<int32>(PrevValue.Value);
+	constexpr int32 MaxSmallDelta = (1 << (SmallDeltaBits - 1)) - 1;
+	if (Writer->WriteBool(bComparable && FMath::Abs(Delta) <= MaxSmallDelta))
+	{
+		const uint32 ZigZag = static_cast<uint32>((Delta << 1) ^ (Delta >> 31));
+		Writer->WriteBits(ZigZag, SmallDeltaBits);
+		return;
+	}
+
+	WriteTurnOffset(Writer, Value);
+}
+
+void FTurnInPlaceSimulatedReplicationNetSerializer::DeserializeDelta(FNetSerializationContext& Context, const FNetDeserializeDeltaArgs& Args)
+{
+	QuantizedType& Target = *reinterpret_cast<QuantizedType*>(Args.Target);
+	const QuantizedType& PrevValue = *reinterpret_cast<const QuantizedType*>(Args.Prev);
+	FNetBitStreamReader* Reader = Context.GetBitStreamReader();
+
+	if (Reader->ReadBool())
+	{
+		Target = PrevValue;
+		return;
+	}
+
+	QuantizedType Value = PrevValue;
+	ReadServerTime(Reader, Value, &PrevValue);
+
+	if (Reader->ReadBool())
+	{
+		Target = Value;
+		return;
+	}
+
+	if (Reader->ReadBool())
+	{
+		const uint32 ZigZag = Reader->ReadBits(SmallDeltaBits);
+		const int32 Delta = static_cast<int32>(ZigZag >> 1) ^ -static_cast<int32>(ZigZag & 1);
+
+		Target = Value;
+		Target.Value = static_cast<uint16>(static_cast<int32>(PrevValue.Value) + Delta);
+		RestoreTurnOffset(Target);
+		return;
+	}
+
+	ReadTurnOffset(Reader, Value);
+	Target = Value;
+}
+
+void FTurnInPlaceSimulatedReplicationNetSerializer::Quantize(FNetSerializationContext& Context, const FNetQuantizeArgs& Args)
+{
+	const SourceType& Source = *reinterpret_cast<const SourceType*>(Args.Source);
+	QuantizedType& Target = *reinterpret_cast<QuantizedType*>(Args.Target);
+
+	const ETurnNetPrecision Precision = Source.ResolvePrecision(Source.NetPrecision.Precision);
+	Target.TurnOffset = Source.TurnOffset;
+	Target.ServerTime = Source.bHasServerTime ? Source.ServerTime : 0;
+	Target.RangeCode = Source.RangeCode;
+	Target.Precision = static_cast<uint8>(Precision);
+	Target.bHasServerTime = Source.bHasServerTime ? 1 : 0;
+	Target.Value = Precision == ETurnNetPrecision::Full ? Source.TurnOffset : static_cast<uint16>(
+		FTurnInPlaceSimulatedReplication::QuantizeAngle(Source.Decompress(), Source.GetRange(),
+			FTurnInPlaceSimulatedReplication::GetValueBits(Precision)));
+}
+
+void FTurnInPlaceSimulatedReplicationNetSerializer::Dequantize(FNetSerializationContext& Context, const FNetDequantizeArgs& Args)
+{
+	const QuantizedType& Source = *reinterpret_cast<const QuantizedType*>(Args.Source);
+	SourceType& Target = *reinterpret_cast<SourceType*>(Args.Target);
+
+	Target.TurnOffset = Source.TurnOffset;
+	Target.RangeCode = Source.RangeCode;
+	Target.ServerTime = Source.ServerTime;
+	Target.bHasServerTime = Source.bHasServerTime != 0;
+}
+
+bool FTurnInPlaceSimulatedReplicationNetSerializer::IsEqualQuantized(const QuantizedType& Value0, const QuantizedType& Value1)
+{
+	return Value0.TurnOffset == Value1.TurnOffset && Value0.Value == Value1.Value && Value0.RangeCode == Value1.RangeCode &&
+		Value0.Precision == Value1.Precision && Value0.ServerTime == Value1.ServerTime && Value0.bHasServerTime == Value1.bHasServerTime;
+}
+
+bool FTurnInPlaceSimulatedReplicationNetSerializer::IsEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Args)
+{
+	if (Args.bStateIsQuantized)
+	{
+		const QuantizedType& Value0 = *reinterpret_cast<const QuantizedType*>(Args.Source0);
+		const QuantizedType& Value1 = *reinterpret_cast<const QuantizedType*>(Args.Source1);
+		return IsEqualQuantized(Value0, Value1);
+	}
+
+	const SourceType& Value0 = *reinterpret_cast<const SourceType*>(Args.Source0);
+	const SourceType& Value1 = *reinterpret_cast<const SourceType*>(Args.Source1);
+	return Value0.TurnOffset == Value1.TurnOffset && Value0.RangeCode == Value1.RangeCode &&
+		Value0.ServerTime == Value1.ServerTime && Value0.bHasServerTime == Value1.bHasServerTime;
+}
+
+bool FTurnInPlaceSimulatedReplicationNetSerializer::Validate(FNetSerializationContext& Context, const FNetValidateArgs& Args)
+{
+	const SourceType& Source = *reinterpret_cast<const SourceType*>(Args.Source);
+	return Source.RangeCode <= FTurnInPlaceSimulatedReplication::RangeCodeMax;
+}
+
+static const FName PropertyNetSerializerRegistry_NAME_TurnInPlaceSimulatedReplication("TurnInPlaceSimulatedReplication");
+UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_TurnInPlaceSimulatedReplication, FTurnInPlaceSimulatedReplicationNetSerializer);
+
+FTurnInPlaceSimulatedReplicationNetSerializer::FNetSerializerRegistryDelegates::~FNetSerializerRegistryDelegates()
+{
+	UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_TurnInPlaceSimulatedReplication);
+}
+
+void FTurnInPlaceSimulatedReplicationNetSerializer::FNetSerializerRegistryDelegates::OnPreFreezeNetSerializerRegistry()
+{
+	UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_TurnInPlaceSimulatedReplication);
+}
+
+}
+
+#endif
@@ -0,0 +1,395 @@
+// Copyright (c) 2025 Jared Taylor
+
+
+#include "Misc/AutomationTest.h"
+#include "TurnInPlaceTypes.h"
+#include "UObject/CoreNet.h"
+
+#if UE_WITH_IRIS
+#include "System/TurnInPlaceNetSerializer.h"
+#include "Iris/Serialization/NetBitStreamReader.h"
+#include "Iris/Serialization/NetBitStreamWriter.h"
+#include "Iris/Serialization/NetSerializationContext.h"
+#endif
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace TurnInPlaceNetSerializerTests
+{
+	static constexpr ETurnNetPrecision Precisions[] = { ETurnNetPrecision::Bits8, ETurnNetPrecision::Bits10,
+		ETurnNetPrecision::Bits12, ETurnNetPrecision::Full };
+
+	/** A turn offset as the server would replicate it */
+	static FTurnInPlaceSimulatedReplication MakeReplication(float Angle, float MaxTurnAngle, ETurnNetPrecision Precision,
+		bool bHasServerTime = false, double ServerTime = 0.0)
+	{
+		FTurnInPlaceSimulatedReplication Rep;
+		Rep.NetPrecision.Precision = Precision;
+		Rep.NetPrecision.bReduceForDistantViewers = false;
+		Rep.Compress(Angle, MaxTurnAngle);
+		Rep.SetServerTime(bHasServerTime, ServerTime);
+		return Rep;
+	}
+
+	/** @return The compressed turn offset a client should receive for Rep */
+	static uint16 GetExpectedTurnOffset(const FTurnInPlaceSimulatedReplication& Rep)
+	{
+		const ETurnNetPrecision Precision = Rep.ResolvePrecision(Rep.NetPrecision.Precision);
+		if (Rep.TurnOffset == 0 || Precision == ETurnNetPrecision::Full)
+		{
+			return Rep.TurnOffset;
+		}
+
+		const uint32 NumBits = FTurnInPlaceSimulatedReplication::GetValueBits(Precision);
+		const uint32 Quantized = FTurnInPlaceSimulatedReplication::QuantizeAngle(Rep.Decompress(), Rep.GetRange(), NumBits);
+		return FRotator::CompressAxisToShort(FTurnInPlaceSimulatedReplication::DequantizeAngle(Quantized, Rep.GetRange(), NumBits));
+	}
+
+	/** @return Largest error expected from quantizing Rep */
+	static float GetTolerance(const FTurnInPlaceSimulatedReplication& Rep)
+	{
+		const float ShortStep = 360.f / 65536.f;
+		const ETurnNetPrecision Precision = Rep.ResolvePrecision(Rep.NetPrecision.Precision);
+		if (Rep.TurnOffset == 0 || Precision == ETurnNetPrecision::Full)
+		{
+			return ShortStep;
+		}
+
+		const uint32 NumBits = FTurnInPlaceSimulatedReplication::GetValueBits(Precision);
+		return Rep.GetRange() / ((1u << NumBits) - 1) + ShortStep;
+	}
+
+	/** Every precision and range code, including angles at the edge of the range and the Full fallback */
+	static TArray<FTurnInPlaceSimulatedReplication> MakeCases()
+	{
+		TArray<FTurnInPlaceSimulatedReplication> Cases;
+		for (const ETurnNetPrecision Precision : Precisions)
+		{
+			for (uint8 RangeCode = 0; RangeCode <= FTurnInPlaceSimulatedReplication::RangeCodeMax; RangeCode++)
+			{
+				const float Range = (RangeCode + 1) * FTurnInPlaceSimulatedReplication::RangeStep;
+				for (const float Alpha : { -1.f, -0.5f, 0.f, 0.0137f, 0.73f, 1.f })
+				{
+					Cases.Add(MakeReplication(Range * Alpha, Range, Precision));
+					Cases.Add(MakeReplication(Range * Alpha, Range, Precision, true, 12.345 * (RangeCode + 1)));
+				}
+			}
+
+			// Exceeds the range, e.g. the turn mode changed this frame, and falls back to Full
+			Cases.Add(MakeReplication(100.f, 45.f, Precision));
+			Cases.Add(MakeReplication(-170.f, 90.f, Precision, true, 70.0));
+		}
+		return Cases;
+	}
+
+	static FString Describe(const FTurnInPlaceSimulatedReplication& Rep)
+	{
+		return FString::Printf(TEXT("TurnOffset %.3f Range %.0f Precision %s ServerTime %s"), Rep.Decompress(), Rep.GetRange(),
+			*UEnum::GetValueAsString(Rep.NetPrecision.Precision),
+			Rep.bHasServerTime ? *FString::FromInt(Rep.ServerTime) : TEXT("None"));
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTurnInPlaceNetSerializeTest, "TurnInPlace.Replication.NetSerialize",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+
+bool FTurnInPlaceNetSerializeTest::RunTest(const FString& Parameters)
+{
+	using namespace TurnInPlaceNetSerializerTests;
+
+	for (FTurnInPlaceSimulatedReplication& Source : MakeCases())
+	{
+		const FString Context = Describe(Source);
+
+		FNetBitWriter Writer(nullptr, 256);
+		bool bSaved = false;
+		Source.NetSerialize(Writer, nullptr, bSaved);
+		TestTrue(Context + TEXT(" saved"), bSaved && !Writer.IsError());
+
+		FNetBitReader Reader(nullptr, Writer.GetData(), Writer.GetNumBits());
+		FTurnInPlaceSimulatedReplication Target;
+		bool bLoaded = false;
+		Target.NetSerialize(Reader, nullptr, bLoaded);
+		TestTrue(Context + TEXT(" loaded"), bLoaded && !Reader.IsError());
+		TestTrue(Context + TEXT(" read every bit"), Reader.AtEnd());
+
+		TestEqual(Context + TEXT(" turn offset"), static_cast<int32>(Target.TurnOffset), static_cast<int32>(GetExpectedTurnOffset(Source)));
+		TestTrue(Context + TEXT(" turn offset within tolerance"),
+			FMath::Abs(FMath::FindDeltaAngleDegrees(Source.Decompress(), Target.Decompress())) <= GetTolerance(Source));
+		TestEqual(Context + TEXT(" has server time"), Target.bHasServerTime, Source.bHasServerTime);
+		TestEqual(Context + TEXT(" server time"), static_cast<int32>(Target.ServerTime), static_cast<int32>(Source.ServerTime));
+
+		// Idle costs a single bit, plus one for the server time flag
+		if (Source.TurnOffset == 0 && !Source.bHasServerTime)
+		{
+			TestEqual(Context + TEXT(" idle bits"), Writer.GetNumBits(), static_cast<int64>(2));
+		}
+	}
+
+	return true;
+}
+
+#if UE_WITH_IRIS
+
+namespace TurnInPlaceNetSerializerTests
+{
+	using namespace UE::Net;
+
+	/** Storage for FTurnInPlaceSimulatedReplicationNetSerializer::QuantizedType, which is private to its translation unit */
+	struct FQuantizedStorage
+	{
+		FQuantizedStorage()
+		{
+			FMemory::Memzero(Buffer);
+		}
+
+		alignas(16) uint8 Buffer[32];
+	};
+
+	struct FIrisTester
+	{
+		FIrisTester()
+			: Serializer(UE_NET_GET_SERIALIZER(FTurnInPlaceSimulatedReplicationNetSerializer))
+		{
+			FMemory::Memzero(BitStreamBuffer);
+		}
+
+		const FNetSerializer& Serializer;
+		alignas(16) uint8 BitStreamBuffer[64];
+
+		template<typename ArgsType>
+		void InitArgs(ArgsType& Args) const
+		{
+			Args.Version = Serializer.Version;
+			Args.NetSerializerConfig = NetSerializerConfigParam(Serializer.DefaultConfig);
+		}
+
+		void Quantize(const FTurnInPlaceSimulatedReplication& Source, FQuantizedStorage& Target) const
+		{
+			FNetSerializationContext Context;
+			FNetQuantizeArgs Args = {};
+			InitArgs(Args);
+			Args.Source = NetSerializerValuePointer(&Source);
+			Args.Target = NetSerializerValuePointer(Target.Buffer);
+			Serializer.Quantize(Context, Args);
+		}
+
+		void Dequantize(const FQuantizedStorage& Source, FTurnInPlaceSimulatedReplication& Target) const
+		{
+			FNetSerializationContext Context;
+			FNetDequantizeArgs Args = {};
+			InitArgs(Args);
+			Args.Source = NetSerializerValuePointer(Source.Buffer);
+			Args.Target = NetSerializerValuePointer(&Target);
+			Serializer.Dequantize(Context, Args);
+		}
+
+		bool IsEqual(const FQuantizedStorage& Value0, const FQuantizedStorage& Value1) const
+		{
+			FNetSerializationContext Context;
+			FNetIsEqualArgs Args = {};
+			InitArgs(Args);
+			Args.Source0 = NetSerializerValuePointer(Value0.Buffer);
+			Args.Source1 = NetSerializerValuePointer(Value1.Buffer);
+			Args.bStateIsQuantized = true;
+			return Serializer.IsEqual(Context, Args);
+		}
+
+		/** @return Number of bits written, or INDEX_NONE on error */
+		int32 Serialize(const FQuantizedStorage& Source, const FQuantizedStorage* Prev)
+		{
+			FMemory::Memzero(BitStreamBuffer);
+			FNetBitStreamWriter Writer;
+			Writer.InitBytes(BitStreamBuffer, sizeof(BitStreamBuffer));
+			FNetSerializationContext Context(&Writer);
+
+			if (Prev)
+			{
+				FNetSerializeDeltaArgs Args = {};
+				InitArgs(Args);
+				Args.Source = NetSerializerValuePointer(Source.Buffer);
+				Args.Prev = NetSerializerValuePointer(Prev->Buffer);
+				Serializer.SerializeDelta(Context, Args);
+			}
+			else
+			{
+				FNetSerializeArgs Args = {};
+				InitArgs(Args);
+				Args.Source = NetSerializerValuePointer(Source.Buffer);
+				Serializer.Serialize(Context, Args);
+			}
+
+			Writer.CommitWrites();
+			return Context.HasErrorOrOverflow() ? INDEX_NONE : static_cast<int32>(Writer.GetPosBits());
+		}
+
+		/** @return True if every bit written by Serialize() was read without error */
+		bool Deserialize(uint32 NumBits, FQuantizedStorage& Target, const FQuantizedStorage* Prev) const
+		{
+			FNetBitStreamReader Reader;
+			Reader.InitBits(BitStreamBuffer, NumBits);
+			FNetSerializationContext Context(&Reader);
+
+			if (Prev)
+			{
+				FNetDeserializeDeltaArgs Args = {};
+				InitArgs(Args);
+				Args.Target = NetSerializerValuePointer(Target.Buffer);
+				Args.Prev = NetSerializerValuePointer(Prev->Buffer);
+				Serializer.DeserializeDelta(Context, Args);
+			}
+			else
+			{
+				FNetDeserializeArgs Args = {};
+				InitArgs(Args);
+				Args.Target = NetSerializerValuePointer(Target.Buffer);
+				Serializer.Deserialize(Context, Args);
+			}
+
+			return !Context.HasErrorOrOverflow() && Reader.GetPosBits() == NumBits;
+		}
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTurnInPlaceIrisSerializeTest, "TurnInPlace.Replication.Iris.Serialize",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+
+bool FTurnInPlaceIrisSerializeTest::RunTest(const FString& Parameters)
+{
+	using namespace TurnInPlaceNetSerializerTests;
+
+	FIrisTester Tester;
+	if (!TestTrue(TEXT("Quantized type fits"), Tester.Serializer.QuantizedTypeSize <= sizeof(FQuantizedStorage::Buffer)))
+	{
+		return false;
+	}
+
+	for (const FTurnInPlaceSimulatedReplication& Source : MakeCases())
+	{
+		const FString Context = Describe(Source);
+
+		FQuantizedStorage Quantized;
+		Tester.Quantize(Source, Quantized);
+
+		const int32 NumBits = Tester.Serialize(Quantized, nullptr);
+		if (!TestTrue(Context + TEXT(" serialized"), NumBits != INDEX_NONE))
+		{
+			continue;
+		}
+
+		FQuantizedStorage Received;
+		TestTrue(Context + TEXT(" deserialized"), Tester.Deserialize(NumBits, Received, nullptr));
+		TestTrue(Context + TEXT(" quantized state matches"), Tester.IsEqual(Quantized, Received));
+
+		FTurnInPlaceSimulatedReplication Target;
+		Tester.Dequantize(Received, Target);
+
+		TestEqual(Context + TEXT(" turn offset"), static_cast<int32>(Target.TurnOffset), static_cast<int32>(GetExpectedTurnOffset(Source)));
+		TestTrue(Context + TEXT(" turn offset within tolerance"),
+			FMath::Abs(FMath::FindDeltaAngleDegrees(Source.Decompress(), Target.Decompress())) <= GetTolerance(Source));
+		TestEqual(Context + TEXT(" has server time"), Target.bHasServerTime, Source.bHasServerTime);
+		TestEqual(Context + TEXT(" server time"), static_cast<int32>(Target.ServerTime), static_cast<int32>(Source.ServerTime));
+
+		// Idle costs a single bit, plus one for the server time flag
+		if (Source.TurnOffset == 0 && !Source.bHasServerTime)
+		{
+			TestEqual(Context + TEXT(" idle bits"), NumBits, 2);
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTurnInPlaceIrisSerializeDeltaTest, "TurnInPlace.Replication.Iris.SerializeDelta",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+
+bool FTurnInPlaceIrisSerializeDeltaTest::RunTest(const FString& Parameters)
+{
+	using namespace TurnInPlaceNetSerializerTests;
+
+	FIrisTester Tester;
+	if (!TestTrue(TEXT("Quantized type fits"), Tester.Serializer.QuantizedTypeSize <= sizeof(FQuantizedStorage::Buffer)))
+	{
+		return false;
+	}
+
+	struct FDeltaCase
+	{
+		const TCHAR* Name;
+		FTurnInPlaceSimulatedReplication Prev;
+		FTurnInPlaceSimulatedReplication Value;
+	};
+
+	TArray<FDeltaCase> Cases = {
+		{ TEXT("Unchanged"), MakeReplication(30.f, 135.f, ETurnNetPrecision::Bits12), MakeReplication(30.f, 135.f, ETurnNetPrecision::Bits12) },
+		{ TEXT("Unchanged idle"), MakeReplication(0.f, 135.f, ETurnNetPrecision::Bits8), MakeReplication(0.f, 135.f, ETurnNetPrecision::Bits8) },
+		{ TEXT("Small change"), MakeReplication(30.f, 135.f, ETurnNetPrecision::Bits12), MakeReplication(30.5f, 135.f, ETurnNetPrecision::Bits12) },
+		{ TEXT("Small negative change"), MakeReplication(-30.f, 90.f, ETurnNetPrecision::Bits10), MakeReplication(-31.f, 90.f, ETurnNetPrecision::Bits10) },
+		{ TEXT("Large change"), MakeReplication(30.f, 135.f, ETurnNetPrecision::Bits8), MakeReplication(-120.f, 135.f, ETurnNetPrecision::Bits8) },
+		{ TEXT("Idle to turning"), MakeReplication(0.f, 135.f, ETurnNetPrecision::Bits12), MakeReplication(2.f, 135.f, ETurnNetPrecision::Bits12) },
+		{ TEXT("Turning to idle"), MakeReplication(2.f, 135.f, ETurnNetPrecision::Bits12), MakeReplication(0.f, 135.f, ETurnNetPrecision::Bits12) },
+		{ TEXT("Range changed"), MakeReplication(30.f, 135.f, ETurnNetPrecision::Bits12), MakeReplication(30.1f, 45.f, ETurnNetPrecision::Bits12) },
+		{ TEXT("Precision changed"), MakeReplication(30.f, 135.f, ETurnNetPrecision::Bits12), MakeReplication(30.f, 135.f, ETurnNetPrecision::Bits8) },
+		{ TEXT("Full fallback"), MakeReplication(30.f, 45.f, ETurnNetPrecision::Bits12), MakeReplication(100.f, 45.f, ETurnNetPrecision::Bits12) },
+		{ TEXT("Full to Full"), MakeReplication(30.f, 135.f, ETurnNetPrecision::Full), MakeReplication(30.2f, 135.f, ETurnNetPrecision::Full) },
+		{ TEXT("Server time only"), MakeReplication(30.f, 135.f, ETurnNetPrecision::Bits12, true, 1.0), MakeReplication(30.f, 135.f, ETurnNetPrecision::Bits12, true, 1.033) },
+		{ TEXT("Server time small delta"), MakeReplication(30.f, 135.f, ETurnNetPrecision::Bits12, true, 1.0), MakeReplication(31.f, 135.f, ETurnNetPrecision::Bits12, true, 1.1) },
+		{ TEXT("Server time large delta"), MakeReplication(30.f, 135.f, ETurnNetPrecision::Bits12, true, 1.0), MakeReplication(31.f, 135.f, ETurnNetPrecision::Bits12, true, 6.0) },
+		{ TEXT("Server time wraps"), MakeReplication(30.f, 135.f, ETurnNetPrecision::Bits12, true, 65.530), MakeReplication(31.f, 135.f, ETurnNetPrecision::Bits12, true, 65.540) },
+		{ TEXT("Server time enabled"), MakeReplication(30.f, 135.f, ETurnNetPrecision::Bits12), MakeReplication(30.f, 135.f, ETurnNetPrecision::Bits12, true, 3.0) },
+		{ TEXT("Server time disabled"), MakeReplication(30.f, 135.f, ETurnNetPrecision::Bits12, true, 3.0), MakeReplication(31.f, 135.f, ETurnNetPrecision::Bits12) },
+	};
+
+	// Changes between every precision and range code
+	for (const ETurnNetPrecision Precision : Precisions)
+	{
+		for (uint8 RangeCode = 0; RangeCode <= FTurnInPlaceSimulatedReplication::RangeCodeMax; RangeCode++)
+		{
+			const float Range = (RangeCode + 1) * FTurnInPlaceSimulatedReplication::RangeStep;
+			Cases.Add({ TEXT("Precision and range"), MakeReplication(Range * 0.5f, Range, Precision, true, 2.0),
+				MakeReplication(Range * 0.52f, Range, Precision, true, 2.016) });
+		}
+	}
+
+	for (const FDeltaCase& Case : Cases)
+	{
+		const FString Context = FString::Printf(TEXT("%s: %s -> %s"), Case.Name, *Describe(Case.Prev), *Describe(Case.Value));
+
+		FQuantizedStorage Prev;
+		FQuantizedStorage Quantized;
+		Tester.Quantize(Case.Prev, Prev);
+		Tester.Quantize(Case.Value, Quantized);
+
+		const int32 NumBits = Tester.Serialize(Quantized, &Prev);
+		if (!TestTrue(Context + TEXT(" serialized"), NumBits != INDEX_NONE))
+		{
+			continue;
+		}
+
+		FQuantizedStorage Received;
+		TestTrue(Context + TEXT(" deserialized"), Tester.Deserialize(NumBits, Received, &Prev));
+		TestTrue(Context + TEXT(" quantized state matches"), Tester.IsEqual(Quantized, Received));
+
+		FTurnInPlaceSimulatedReplication Target;
+		Tester.Dequantize(Received, Target);
+		TestEqual(Context + TEXT(" turn offset"), static_cast<int32>(Target.TurnOffset), static_cast<int32>(GetExpectedTurnOffset(Case.Value)));
+		TestEqual(Context + TEXT(" has server time"), Target.bHasServerTime, Case.Value.bHasServerTime);
+		TestEqual(Context + TEXT(" server time"), static_cast<int32>(Target.ServerTime), static_cast<int32>(Case.Value.ServerTime));
+
+		// An unchanged state costs a single bit
+		if (Tester.IsEqual(Quantized, Prev))
+		{
+			TestEqual(Context + TEXT(" unchanged bits"), NumBits, 1);
+		}
+
+		// A delta costs at most its three change bits more than sending the full state
+		const int32 FullBits = Tester.Serialize(Quantized, nullptr);
+		TestTrue(Context + TEXT(" delta is no larger than the full state"), NumBits <= FullBits + 3);
+	}
+
+	return true;
+}
+
+#endif  // UE_WITH_IRIS
+
+#endif  // WITH_DEV_AUTOMATION_TESTS
@@ -5,6 +5,8 @@
 
 #include "GameplayTagContainer.h"
 #include "TurnInPlaceAnimInterface.h"
+#include "TurnInPlaceAnimSetAsset.h"
+#include "Implementation/TurnInPlaceAnimInstance.h"
 #include "GameFramework/Controller.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Animation/AnimInstance.h"
@@ -26,18 +28,39 @@
 #endif
 
 #include "TurnInPlaceStatics.h"
+#include "TurnInPlaceWorldSubsystem.h"
+#include "System/TurnInPlaceStats.h"
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/GameStateBase.h"
+#include "Misc/ScopeExit.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(TurnInPlace)
 
-DEFINE_LOG_CATEGORY_STATIC(LogTurnInPlace, Log, All);
-
 #define LOCTEXT_NAMESPACE "TurnInPlaceComponent"
 
+DEFINE_STAT(STAT_TurnInPlaceSleeping);
+DEFINE_STAT(STAT_TurnInPlaceAwake);
+DEFINE_STAT(STAT_TurnInPlaceSweptRotations);
+DEFINE_STAT(STAT_TurnInPlaceUnsweptRotations);
+
 namespace TurnInPlaceCvars
 {
+	static bool bSkipIdleTurnInPlace = true;
+	FAutoConsoleVariableRef CVarSkipIdleTurnInPlace(
+		TEXT("p.Turn.SkipIdle"),
+		bSkipIdleTurnInPlace,
+		TEXT("Skip TurnInPlace() when none of its inputs have changed since an evaluation that changed nothing"),
+		ECVF_Default);
+
+	static bool bEnableUpdateLOD = true;
+	FAutoConsoleVariableRef CVarEnableUpdateLOD(
+		TEXT("p.Turn.LOD.Enable"),
+		bEnableUpdateLOD,
+		TEXT("Allow ServerUpdateLOD and SimulatedProxyUpdateLOD to reduce how often turn in place is updated"),
+		ECVF_Default);
+
 #if UE_ENABLE_DEBUG_DRAWING
 	static bool bDebugTurnOffset = false;
 	FAutoConsoleVariableRef CVarDebugTurnOffset(
@@ -75,12 +98,20 @@ namespace TurnInPlaceCvars
 		OverrideTurnInPlace,
 		TEXT("Override Turn In Place. 0 = Default, 1 = Force Enabled, 2 = Force Locked, 3 = Force Paused (Disabled)"),
 		ECVF_Cheat);
+
+	static int32 ForceUpdateTier = -1;
+	FAutoConsoleVariableRef CVarForceUpdateTier(
+		TEXT("p.Turn.LOD.ForceTier"),
+		ForceUpdateTier,
+		TEXT("Force the update tier for components with update LOD enabled. -1 = Default, 0 = Full, 1 = Reduced, 2 = Frozen"),
+		ECVF_Cheat);
 #endif
 }
 
 UTurnInPlace::UTurnInPlace(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, bIsValidAnimInstance(false)
+	, bHasValidBinding(false)
 	, bWarnIfAnimInterfaceNotImplemented(true)
 	, bHasWarned(false)
 {
@@ -102,6 +133,20 @@ void UTurnInPlace::GetLifetimeReplicatedProps(TArray<class FLifetimeProperty>& O
 	SharedParams.Condition = COND_SimulatedOnly;
 
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, SimulatedTurnOffset, SharedParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, SimulatedTurnEvent, SharedParams);
+}
+
+void UTurnInPlace::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	Super::AddReferencedObjects(InThis, Collector);
+
+	// The snapshot is not a UPROPERTY, so report the anims and montages it references
+	const UTurnInPlace* This = CastChecked<UTurnInPlace>(InThis);
+	if (This->AnimSetSnapshot.IsValid())
+	{
+		FTurnInPlaceAnimSet& AnimSet = const_cast<FTurnInPlaceAnimSet&>(This->AnimSetSnapshot->AnimSet);
+		Collector.AddPropertyReferences(FTurnInPlaceAnimSet::StaticStruct(), &AnimSet, InThis);
+	}
 }
 
 ENetRole UTurnInPlace::GetLocalRole() const
@@ -121,14 +166,201 @@ void UTurnInPlace::CompressSimulatedTurnOffset(float LastTurnOffset)
 	// Compress result and replicate turn offset to simulated proxy
 	if (HasAuthority() && GetNetMode() != NM_Standalone)
 	{
-		if (HasTurnOffsetChanged(GetTurnOffset(), LastTurnOffset))
+		// Simulated proxies reconstruct the turn offset from their curves while turning
+		// Turn events can't be sent when the owner replicates the turn offset instead of us
+		if (SimulatedReplicationMode == ETurnReplicationMode::TurnEvents && GetIsReplicated() && ReplicateTurnEvents())
 		{
-			SimulatedTurnOffset.Compress(GetTurnOffset());
+			return;
+		}
+
+		// Compared against the last replicated turn offset rather than LastTurnOffset, so changes held back by the
+		// deadband accumulate and eventually go stale
+		const float TurnOffset = GetTurnOffset();
+
+		if (ShouldReplicateTurnOffset(TurnOffset))
+		{
+			// Quantized over the active max turn angle when replicated
+			const FTurnInPlaceAngles* TurnAngles = GetFrameContext().GetTurnAngles();
+			SimulatedTurnOffset.NetPrecision = SimulatedNetPrecision;
+			SimulatedTurnOffset.Owner = GetOwner();
+			SimulatedTurnOffset.Compress(TurnOffset, TurnAngles ? TurnAngles->MaxTurnAngle : 0.f);
+			SimulatedTurnOffset.SetServerTime(SimulatedProxyExtrapolation.bEnableExtrapolation, GetWorld()->GetTimeSeconds());
 			MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, SimulatedTurnOffset, this);
+
+			LastReplicatedTurnOffset = TurnOffset;
+			LastReplicatedTurnOffsetTime = GetWorld()->GetTimeSeconds();
 		}
 	}
 }
 
+bool UTurnInPlace::ShouldReplicateTurnOffset(float TurnOffset) const
+{
+	if (!HasTurnOffsetChanged(TurnOffset, LastReplicatedTurnOffset))
+	{
+		return false;
+	}
+
+	// Always let simulated proxies settle exactly at rest
+	const float Deadband = SimulatedNetPrecision.Deadband;
+	if (Deadband <= 0.f || TurnOffset == 0.f)
+	{
+		return true;
+	}
+
+	if (FMath::Abs(FMath::FindDeltaAngleDegrees(LastReplicatedTurnOffset, TurnOffset)) >= Deadband)
+	{
+		return true;
+	}
+
+	return GetWorld()->GetTimeSeconds() - LastReplicatedTurnOffsetTime >= SimulatedNetPrecision.MaxStaleness;
+}
+
+void UTurnInPlace::ExtrapolateSimulatedTurnOffset(float DeltaTime)
+{
+	if (!SimulatedProxyExtrapolation.bEnableExtrapolation || !HasValidData())
+	{
+		return;
+	}
+
+	const float Delta = OffsetExtrapolator.Step(DeltaTime, SimulatedProxyExtrapolation);
+	if (Delta == 0.f)
+	{
+		return;
+	}
+
+	// Never extrapolate beyond the max turn angle
+	float TurnOffset = FRotator::NormalizeAxis(TurnData.TurnOffset + Delta);
+	const FTurnInPlaceAngles* TurnAngles = GetFrameContext().GetTurnAngles();
+	if (TurnAngles && TurnAngles->MaxTurnAngle > 0.f)
+	{
+		TurnOffset = FMath::Clamp(TurnOffset, -TurnAngles->MaxTurnAngle, TurnAngles->MaxTurnAngle);
+	}
+	TurnData.TurnOffset = TurnOffset;
+}
+
+bool UTurnInPlace::ReplicateTurnEvents()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::ReplicateTurnEvents);
+
+	const FTurnInPlaceFrameContext& Context = GetFrameContext();
+	if (!Context.bHasValidData)
+	{
+		return false;
+	}
+
+	const bool bIsTurning = Context.IsTurning();
+	LatchReplicatedTurnStep(Context, bIsTurning);
+	if (bIsTurning == bReplicatedTurnStarted)
+	{
+		return bIsTurning;
+	}
+	bReplicatedTurnStarted = bIsTurning;
+
+	ETurnEventType Type = ETurnEventType::Start;
+	if (!bIsTurning)
+	{
+		const bool bAborted = Context.EnabledState != ETurnInPlaceEnabledState::Enabled && CanAbortTurnAnimation();
+		Type = bAborted ? ETurnEventType::Abort : ETurnEventType::Recovery;
+	}
+
+	const AGameStateBase* GameState = GetWorld()->GetGameState();
+	const float TurnOffset = GetTurnOffset();
+
+	// Recovery and abort carry the step of the turn they end
+	if (ReplicatedTurnStepSize == INDEX_NONE)
+	{
+		ReplicatedTurnStepSize = DetermineStepSize(*Context.Snapshot, TurnOffset, bReplicatedTurnRight);
+	}
+
+	SimulatedTurnEvent.EventId++;
+	SimulatedTurnEvent.Type = Type;
+	SimulatedTurnEvent.StepSize = static_cast<uint8>(ReplicatedTurnStepSize);
+	SimulatedTurnEvent.bTurnRight = bReplicatedTurnRight;
+	SimulatedTurnEvent.ServerTime = GameState ? GameState->GetServerWorldTimeSeconds() : GetWorld()->GetTimeSeconds();
+	SimulatedTurnEvent.TurnOffset = FRotator::CompressAxisToShort(TurnOffset);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, SimulatedTurnEvent, this);
+
+	return bIsTurning;
+}
+
+void UTurnInPlace::LatchReplicatedTurnStep(const FTurnInPlaceFrameContext& Context, bool bIsTurning)
+{
+	// The pseudo anim state knows exactly which turn it is playing
+	if (WantsPseudoAnimState() && PseudoAnimState == ETurnPseudoAnimState::TurnInPlace)
+	{
+		ReplicatedTurnStepSize = PseudoNodeData.StepSize;
+		bReplicatedTurnRight = PseudoNodeData.bIsTurningRight;
+		return;
+	}
+
+	// Keep the step until the turn that uses it has ended
+	if (bIsTurning || bReplicatedTurnStarted)
+	{
+		return;
+	}
+
+	// The anim graph selects the step on the first frame it wants to turn, @see BuildAnimGraphData()
+	const FTurnInPlaceAngles* TurnAngles = Context.GetTurnAngles();
+	const float TurnOffset = GetTurnOffset();
+	const bool bWantsToTurn = TurnAngles && Context.EnabledState != ETurnInPlaceEnabledState::Locked &&
+		FMath::Abs(TurnOffset) >= TurnAngles->MinTurnAngle;
+	if (!bWantsToTurn)
+	{
+		ReplicatedTurnStepSize = INDEX_NONE;
+	}
+	else if (ReplicatedTurnStepSize == INDEX_NONE)
+	{
+		ReplicatedTurnStepSize = DetermineStepSize(*Context.Snapshot, TurnOffset, bReplicatedTurnRight);
+	}
+}
+
+void UTurnInPlace::OnRep_SimulatedTurnEvent()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::OnRep_SimulatedTurnEvent);
+
+	if (GetLocalRole() != ROLE_SimulatedProxy || !HasValidData() || SimulatedTurnEvent.Type == ETurnEventType::None)
+	{
+		return;
+	}
+
+	// Resync to the server, our curves take it from here
+	TurnData.TurnOffset = SimulatedTurnEvent.GetTurnOffset();
+	OffsetExtrapolator.Reset();
+
+	if (SimulatedTurnEvent.Type != ETurnEventType::Start)
+	{
+		TurnEventStepSize = INDEX_NONE;
+		return;
+	}
+
+	// The curve belongs to a new turn, don't apply the delta from the previous one
+	TurnData.bLastUpdateValidCurveValue = false;
+
+	// Play the same turn as the server, rather than reselecting it from our own turn offset
+	TurnEventStepSize = SimulatedTurnEvent.StepSize;
+	bTurnEventTurnRight = SimulatedTurnEvent.bTurnRight;
+	TurnEventStartTime = 0.f;
+
+	// Catch up to the time the server has spent in the turn since it started, which matters at low server tick rates
+	const AGameStateBase* GameState = GetWorld()->GetGameState();
+	const float ElapsedTime = GameState ? GameState->GetServerWorldTimeSeconds() - SimulatedTurnEvent.ServerTime : 0.f;
+	if (ElapsedTime <= 0.f)
+	{
+		return;
+	}
+
+	const FTurnInPlaceAnimSet& AnimSet = GetAnimSetSnapshot()->AnimSet;
+	const TArray<TObjectPtr<UAnimSequence>>& TurnAnimations = bTurnEventTurnRight ? AnimSet.RightTurns : AnimSet.LeftTurns;
+	const UAnimSequence* TurnAnimation = TurnAnimations.IsValidIndex(TurnEventStepSize) ? TurnAnimations[TurnEventStepSize].Get() : nullptr;
+	const FTurnInPlaceCurveTablePtr Table = FTurnInPlaceCurveTableCache::FindOrBake(TurnAnimation, Settings);
+	if (Table.IsValid())
+	{
+		// Apply the turn the server's curves have applied so far, and start the animation from the same point
+		TurnEventStartTime = FMath::Min(ElapsedTime * TurnAnimation->RateScale, TurnAnimation->GetPlayLength());
+		TurnData.TurnOffset = FRotator::NormalizeAxis(TurnData.TurnOffset + Table->GetAppliedTurnYaw(TurnEventStartTime));
+	}
+}
+
 void UTurnInPlace::OnRep_SimulatedTurnOffset()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::OnRep_SimulatedTurnOffset);
@@ -137,10 +369,25 @@ void UTurnInPlace::OnRep_SimulatedTurnOffset()
 	// This keeps simulated proxies in sync with the server and allows them to turn in place
 	if (GetLocalRole() == ROLE_SimulatedProxy && HasValidData())
 	{
-		TurnData.TurnOffset = SimulatedTurnOffset.Decompress();
+		if (SimulatedProxyExtrapolation.bEnableExtrapolation)
+		{
+			// Correct towards the replicated value over time instead of snapping, unless the error is large
+			TurnData.TurnOffset = OffsetExtrapolator.Receive(SimulatedTurnOffset.Decompress(), TurnData.TurnOffset,
+				SimulatedTurnOffset.ServerTime, SimulatedTurnOffset.bHasServerTime, SimulatedProxyExtrapolation);
+		}
+		else
+		{
+			TurnData.TurnOffset = SimulatedTurnOffset.Decompress();
+		}
 	}
 }
 
+void UTurnInPlace::ReceiveSimulatedTurnOffset(const FTurnInPlaceSimulatedReplication& InSimulatedTurnOffset)
+{
+	SimulatedTurnOffset = InSimulatedTurnOffset;
+	OnRep_SimulatedTurnOffset();
+}
+
 void UTurnInPlace::OnRegister()
 {
 	Super::OnRegister();
@@ -161,59 +408,187 @@ void UTurnInPlace::CacheUpdatedCharacter_Implementation()
 {
 	PawnOwner = IsValid(GetOwner()) ? Cast<APawn>(GetOwner()) : nullptr;
 	MaybeCharacter = IsValid(GetOwner()) ? Cast<ACharacter>(GetOwner()) : nullptr;
+
+	// Resolves the mesh as well
+	RefreshBinding();
 }
 
 void UTurnInPlace::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// The mesh may have changed since we were registered
+	CacheUpdatedCharacter();
+
+	// In case CacheUpdatedCharacter() was overridden without calling the parent
+	RefreshCachedMesh();
+
+	bCacheMontageOverrides = CanCacheMontageOverrides();
+	MontageOverrideCache.Reset();
+
+#if WITH_EDITOR
+	AnimSetAssetChangedHandle = UTurnInPlaceAnimSetAsset::OnAnimSetAssetChanged.AddUObject(this, &ThisClass::OnAnimSetAssetChanged);
+#endif
+
 	// Bind to the Mesh event to detect when the AnimInstance changes so we can recache it and check if it implements UTurnInPlaceAnimInterface
 	if (ensureAlways(IsValid(GetOwner())))
 	{
-		if (GetMesh())
+		GetOwner()->OnDestroyed.AddUniqueDynamic(this, &ThisClass::OnOwnerDestroyed);
+		
+		if (CachedMesh)
 		{
-			if (GetMesh()->OnAnimInitialized.IsBound())
+			if (CachedMesh->OnAnimInitialized.IsBound())
 			{
-				GetMesh()->OnAnimInitialized.RemoveDynamic(this, &ThisClass::OnAnimInstanceChanged);
+				CachedMesh->OnAnimInitialized.RemoveDynamic(this, &ThisClass::OnAnimInstanceChanged);
 			}
-			GetMesh()->OnAnimInitialized.AddDynamic(this, &ThisClass::OnAnimInstanceChanged);
+			CachedMesh->OnAnimInitialized.AddDynamic(this, &ThisClass::OnAnimInstanceChanged);
 			OnAnimInstanceChanged();
 		}
 	}
+
+	// Let the subsystem advance our pseudo anim state alongside everyone else's
+	// Without animation there is no anim instance to do it for us
+	if ((bBatchPseudoAnimState || IsAnimationFree()) && WantsPseudoAnimState())
+	{
+		if (UTurnInPlaceWorldSubsystem* Subsystem = UWorld::GetSubsystem<UTurnInPlaceWorldSubsystem>(GetWorld()))
+		{
+			Subsystem->RegisterComponent(this);
+		}
+	}
+}
+
+void UTurnInPlace::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (IsValid(GetOwner()))
+	{
+		GetOwner()->OnDestroyed.RemoveDynamic(this, &ThisClass::OnOwnerDestroyed);
+	}
+
+	if (IsPseudoAnimStateBatched())
+	{
+		if (UTurnInPlaceWorldSubsystem* Subsystem = UWorld::GetSubsystem<UTurnInPlaceWorldSubsystem>(GetWorld()))
+		{
+			Subsystem->UnregisterComponent(this);
+		}
+	}
+
+#if WITH_EDITOR
+	UTurnInPlaceAnimSetAsset::OnAnimSetAssetChanged.Remove(AnimSetAssetChangedHandle);
+	AnimSetAssetChangedHandle.Reset();
+#endif
+
+	// Nothing should be processed after this point
+	bHasValidBinding = false;
+	
+	Super::EndPlay(EndPlayReason);
 }
 
 void UTurnInPlace::DestroyComponent(bool bPromoteChildren)
 {
 	// Unbind from the Mesh's AnimInstance event
-	if (GetMesh())
+	BindMontageEvents(false);
+	if (CachedMesh)
 	{
-		if (GetMesh()->OnAnimInitialized.IsBound())
+		if (CachedMesh->OnAnimInitialized.IsBound())
 		{
-			GetMesh()->OnAnimInitialized.RemoveDynamic(this, &ThisClass::OnAnimInstanceChanged);
+			CachedMesh->OnAnimInitialized.RemoveDynamic(this, &ThisClass::OnAnimInstanceChanged);
 		}
 	}
+	bHasValidBinding = false;
 	
 	Super::DestroyComponent(bPromoteChildren);
 }
 
+void UTurnInPlace::OnOwnerDestroyed(AActor* DestroyedActor)
+{
+	bHasValidBinding = false;
+}
+
+#if WITH_EDITOR
+void UTurnInPlace::OnAnimSetAssetChanged(UTurnInPlaceAnimSetAsset* Asset)
+{
+	if (AnimSetSource == ETurnAnimSetSource::DataAsset && GetAnimSetAsset() == Asset)
+	{
+		NotifyAnimSetChanged();
+	}
+}
+#endif
+
+bool UTurnInPlace::RefreshCachedMesh()
+{
+	// Only resolved when the binding is refreshed, GetMesh() may need to search the owner's components
+	USkeletalMeshComponent* Mesh = GetMesh();
+	if (Mesh == CachedMesh)
+	{
+		return false;
+	}
+
+	// Move the AnimInstance binding over to the new mesh
+	if (CachedMesh)
+	{
+		CachedMesh->OnAnimInitialized.RemoveDynamic(this, &ThisClass::OnAnimInstanceChanged);
+	}
+	CachedMesh = Mesh;
+	if (CachedMesh)
+	{
+		CachedMesh->OnAnimInitialized.AddUniqueDynamic(this, &ThisClass::OnAnimInstanceChanged);
+	}
+	return true;
+}
+
+void UTurnInPlace::RefreshBinding()
+{
+	// The mesh may have been swapped since it was last resolved
+	if (RefreshCachedMesh())
+	{
+		// Recache the AnimInstance from the new mesh, this refreshes the binding again
+		OnAnimInstanceChanged();
+		return;
+	}
+
+	// We need a valid AnimInstance and Character to proceed, and the anim instance must implement the TurnInPlaceAnimInterface
+	// Unless we're running without animation, in which case we only need the owner
+	bHasValidBinding = (bIsValidAnimInstance || IsAnimationFree()) && IsValid(GetOwner()) && !GetOwner()->IsPendingKillPending();
+	InvalidateFrameContext();
+}
+
 void UTurnInPlace::OnAnimInstanceChanged()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::OnAnimInstanceChanged);
 	
+	// The AnimInstance may belong to a different mesh than the one we resolved
+	RefreshCachedMesh();
+
 	// Cache the AnimInstance and check if it implements UTurnInPlaceAnimInterface
-	AnimInstance = GetMesh()->GetAnimInstance();
+	BindMontageEvents(false);
+	AnimInstance = CachedMesh ? CachedMesh->GetAnimInstance() : nullptr;
+	BindMontageEvents(true);
+	NativeAnimInstance = nullptr;
 	bIsValidAnimInstance = false;
+
+	// Curve values were published by the previous anim instance
+	CurveChannel.Reset();
+
+	// The anim set belongs to the previous anim instance
+	NotifyAnimSetChanged();
 	if (IsValid(AnimInstance))
 	{
 		// Check if the AnimInstance implements the TurnInPlaceAnimInterface and cache the result so we don't have to check every frame
 		bIsValidAnimInstance = AnimInstance->Implements<UTurnInPlaceAnimInterface>();
-		if (!bIsValidAnimInstance && bWarnIfAnimInterfaceNotImplemented && !bHasWarned)
+
+		// Native anim instances can be queried directly, unless blueprint has overridden the interface
+		UTurnInPlaceAnimInstance* TurnAnimInstance = Cast<UTurnInPlaceAnimInstance>(AnimInstance);
+		if (TurnAnimInstance && !UTurnInPlaceAnimInstance::IsInterfaceImplementedInScript(TurnAnimInstance->GetClass()))
+		{
+			NativeAnimInstance = TurnAnimInstance;
+		}
+		if (!bIsValidAnimInstance && !IsAnimationFree() && bWarnIfAnimInterfaceNotImplemented && !bHasWarned)
 		{
 			// Log a warning if the AnimInstance does not implement the TurnInPlaceAnimInterface
 			bHasWarned = true;
 			const FText ErrorMsg = FText::Format(
 				LOCTEXT("InvalidAnimInstance", "The anim instance {0} assigned to {1} on {2} does not implement the TurnInPlaceAnimInterface."),
-				FText::FromString(AnimInstance->GetClass()->GetName()), FText::FromString(GetMesh()->GetName()), FText::FromString(GetName()));
+				FText::FromString(AnimInstance->GetClass()->GetName()), FText::FromString(CachedMesh->GetName()), FText::FromString(GetName()));
 #if WITH_EDITOR
 			// Show a notification in the editor
 			FNotificationInfo Info(FText::FromString("Invalid Turn In Place Setup. See Message Log."));
@@ -228,12 +603,43 @@ void UTurnInPlace::OnAnimInstanceChanged()
 #endif
 		}
 	}
+
+	RefreshBinding();
+}
+
+void UTurnInPlace::OnMontageStarted(UAnimMontage* Montage)
+{
+	InvalidateFrameContext();
+}
+
+void UTurnInPlace::OnMontageEnded(UAnimMontage* Montage, bool bInterrupted)
+{
+	InvalidateFrameContext();
+}
+
+void UTurnInPlace::BindMontageEvents(bool bBind)
+{
+	if (!IsValid(AnimInstance))
+	{
+		return;
+	}
+
+	if (bBind)
+	{
+		AnimInstance->OnMontageStarted.AddUniqueDynamic(this, &ThisClass::OnMontageStarted);
+		AnimInstance->OnMontageEnded.AddUniqueDynamic(this, &ThisClass::OnMontageEnded);
+	}
+	else
+	{
+		AnimInstance->OnMontageStarted.RemoveDynamic(this, &ThisClass::OnMontageStarted);
+		AnimInstance->OnMontageEnded.RemoveDynamic(this, &ThisClass::OnMontageEnded);
+	}
 }
 
 bool UTurnInPlace::IsTurningInPlace() const
 {
 	// We are turning in place if the weight curve is not 0
-	return HasValidData() && !FMath::IsNearlyZero(GetCurveValues().TurnYawWeight, KINDA_SMALL_NUMBER);
+	return GetFrameContext().IsTurning();
 }
 
 USkeletalMeshComponent* UTurnInPlace::GetMesh_Implementation() const
@@ -245,6 +651,82 @@ USkeletalMeshComponent* UTurnInPlace::GetMesh_Implementation() const
 	return GetOwner() ? GetOwner()->FindComponentByClass<USkeletalMeshComponent>() : nullptr;
 }
 
+ETurnUpdateTier UTurnInPlace::GetUpdateTier() const
+{
+	if (UpdateTierFrame == GFrameCounter)
+	{
+		return UpdateTier;
+	}
+
+	UpdateTierFrame = GFrameCounter;
+	UpdateTier = ETurnUpdateTier::Full;
+
+	const FTurnInPlaceUpdateLOD* LOD = GetUpdateLOD();
+	if (!TurnInPlaceCvars::bEnableUpdateLOD || !LOD || !LOD->bEnableLOD)
+	{
+		return UpdateTier;
+	}
+
+#if !UE_BUILD_SHIPPING
+	if (TurnInPlaceCvars::ForceUpdateTier >= 0)
+	{
+		UpdateTier = static_cast<ETurnUpdateTier>(FMath::Min<int32>(TurnInPlaceCvars::ForceUpdateTier, static_cast<int32>(ETurnUpdateTier::Frozen)));
+		return UpdateTier;
+	}
+#endif
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::GetUpdateTier);
+	UpdateTier = EvaluateUpdateTier(*LOD);
+	return UpdateTier;
+}
+
+bool UTurnInPlace::IsProceduralTurn() const
+{
+	if (GetUpdateTier() != ETurnUpdateTier::Reduced)
+	{
+		return false;
+	}
+	const FTurnInPlaceUpdateLOD* LOD = GetUpdateLOD();
+	return LOD && LOD->bProceduralTurnWhenReduced;
+}
+
+const FTurnInPlaceUpdateLOD* UTurnInPlace::GetUpdateLOD() const
+{
+	switch (GetOwnerRole())
+	{
+	case ROLE_Authority: return &ServerUpdateLOD;
+	case ROLE_SimulatedProxy: return &SimulatedProxyUpdateLOD;
+	default: return nullptr;
+	}
+}
+
+ETurnUpdateTier UTurnInPlace::EvaluateUpdateTier_Implementation(const FTurnInPlaceUpdateLOD& LOD) const
+{
+	const UWorld* World = GetWorld();
+	UTurnInPlaceWorldSubsystem* Subsystem = World ? World->GetSubsystem<UTurnInPlaceWorldSubsystem>() : nullptr;
+	if (!Subsystem || !GetOwner())
+	{
+		return ETurnUpdateTier::Full;
+	}
+
+	const float DistSq = Subsystem->GetDistSqToNearestView(GetOwner()->GetActorLocation());
+	if (LOD.FrozenDistance > 0.f && DistSq > FMath::Square(LOD.FrozenDistance))
+	{
+		return ETurnUpdateTier::Frozen;
+	}
+	if (DistSq > FMath::Square(LOD.ReducedDistance))
+	{
+		return ETurnUpdateTier::Reduced;
+	}
+
+	// Dedicated servers don't render, so this would always be true
+	if (LOD.bReduceWhenNotRendered && GetNetMode() != NM_DedicatedServer && CachedMesh && !CachedMesh->WasRecentlyRendered())
+	{
+		return ETurnUpdateTier::Reduced;
+	}
+	return ETurnUpdateTier::Full;
+}
+
 bool UTurnInPlace::IsCharacterStationary() const
 {
 	return GetOwner()->GetVelocity().IsNearlyZero();
@@ -255,7 +737,7 @@ UAnimMontage* UTurnInPlace::GetCurrentNetworkRootMotionMontage() const
 	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::GetCurrentNetworkRootMotionMontage);
 	
 	// Check if the character is playing a networked root motion montage
-	if (bIsValidAnimInstance && IsPlayingNetworkedRootMotionMontage())
+	if (IsValid(AnimInstance) && IsPlayingNetworkedRootMotionMontage())
 	{
 		// Get the root motion montage instance and return the montage
 		if (const FAnimMontageInstance* MontageInstance = AnimInstance->GetRootMotionMontageInstance())
@@ -273,7 +755,8 @@ ETurnInPlaceOverride UTurnInPlace::GetOverrideForMontage_Implementation(const UA
 	// Allow overriding per-montage
 	if (HasValidData() && Montage)
 	{
-		FTurnInPlaceParams Params = GetParams();
+		const FTurnInPlaceAnimSetSnapshotPtr Snapshot = GetAnimSetSnapshot();
+		const FTurnInPlaceParams& Params = Snapshot->GetParams();
 		if (const ETurnInPlaceOverride* Override = Params.MontageHandling.MontageOverrides.Find(Montage))
 		{
 #if WITH_EDITOR
@@ -309,10 +792,11 @@ bool UTurnInPlace::ShouldIgnoreRootMotionMontage_Implementation(const UAnimMonta
 		return false;
 	}
 
-	FTurnInPlaceParams Params = GetParams();
+	const FTurnInPlaceAnimSetSnapshotPtr Snapshot = GetAnimSetSnapshot();
+	const FTurnInPlaceParams& Params = Snapshot->GetParams();
 
 	// Check if the montage itself is ignored
-	if (Params.MontageHandling.IgnoreMontages.Contains(Montage))
+	if (Snapshot->IgnoredMontages.Contains(Montage))
 	{
 		return true;
 	}
@@ -354,98 +838,456 @@ FVector UTurnInPlace::GetDebugDrawArrowLocation_Implementation(bool& bIsValidLoc
 #endif
 }
 
-ETurnInPlaceOverride UTurnInPlace::OverrideTurnInPlace_Implementation() const
+ETurnInPlaceOverride UTurnInPlace::OverrideTurnInPlace_Implementation() const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::OverrideTurnInPlace);
+	
+#if !UE_BUILD_SHIPPING
+	if (TurnInPlaceCvars::OverrideTurnInPlace > 0)
+	{
+		switch (TurnInPlaceCvars::OverrideTurnInPlace)
+		{
+		case 1: return ETurnInPlaceOverride::ForceEnabled;
+		case 2: return ETurnInPlaceOverride::ForceLocked;
+		case 3: return ETurnInPlaceOverride::ForcePaused;
+		default: break;
+		}
+	}
+#endif
+
+	// Curve values are used to determine if we should pause or lock turn in place
+	// These were already read when building the frame context, which is what calls us
+	const FTurnInPlaceCurveValues& CurveValues = GetFrameContext().CurveValues;
+
+	if (FMath::IsNearlyEqual(CurveValues.PauseTurnInPlace, 1.f, 0.05f))
+	{
+		// We want to pause turn in place if the weight curve is not 0
+		return ETurnInPlaceOverride::ForcePaused;
+	}
+
+	if (FMath::IsNearlyEqual(CurveValues.LockTurnInPlace, 1.f, 0.05f))
+	{
+		// We want to lock turn in place if the weight curve is not 0
+		return ETurnInPlaceOverride::ForceLocked;
+	}
+
+	// We want to pause turn in place when using root motion montages, unless the montage is ignored or overridden
+	if (const UAnimMontage* Montage = GetCurrentNetworkRootMotionMontage())
+	{
+		return ResolveMontageOverride(Montage);
+	}
+
+	return ETurnInPlaceOverride::Default;
+}
+
+ETurnInPlaceOverride UTurnInPlace::ResolveMontageOverride(const UAnimMontage* Montage) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::ResolveMontageOverride);
+
+	if (!Montage)
+	{
+		return ETurnInPlaceOverride::Default;
+	}
+
+	// Cached results are only valid for the montage handling they were resolved with
+	// Only compare it when the snapshot changes, a rebuilt snapshot usually has the same montage handling
+	const FTurnInPlaceAnimSetSnapshotPtr Snapshot = GetAnimSetSnapshot();
+	if (MontageOverrideCacheSnapshotId != Snapshot->SnapshotId)
+	{
+		MontageOverrideCacheSnapshotId = Snapshot->SnapshotId;
+
+		const FTurnInPlaceMontageHandling& MontageHandling = Snapshot->GetParams().MontageHandling;
+		if (!FTurnInPlaceMontageHandling::StaticStruct()->CompareScriptStruct(&MontageOverrideCacheHandling, &MontageHandling, PPF_None))
+		{
+			MontageOverrideCache.Reset();
+			MontageOverrideCacheHandling = MontageHandling;
+		}
+	}
+
+	if (const ETurnInPlaceOverride* CachedOverride = bCacheMontageOverrides ? MontageOverrideCache.Find(Montage) : nullptr)
+	{
+		return *CachedOverride;
+	}
+
+	// Montages can be given a specific override
+	ETurnInPlaceOverride Override = GetOverrideForMontage(Montage);
+	if (Override == ETurnInPlaceOverride::Default)
+	{
+		// Otherwise pause turn in place, unless the montage is ignored by our current params
+		if (!ShouldIgnoreRootMotionMontage(Montage))
+		{
+			Override = ETurnInPlaceOverride::ForcePaused;
+		}
+	}
+
+	if (bCacheMontageOverrides)
+	{
+		MontageOverrideCache.Add(Montage, Override);
+	}
+	return Override;
+}
+
+bool UTurnInPlace::CanCacheMontageOverrides() const
+{
+	// Blueprint overrides may depend on any state, so we can't know when their result changes
+	return !GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UTurnInPlace, GetOverrideForMontage)) &&
+		!GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UTurnInPlace, ShouldIgnoreRootMotionMontage));
+}
+
+void UTurnInPlace::InvalidateMontageOverrideCache()
+{
+	MontageOverrideCache.Reset();
+	InvalidateFrameContext();
+}
+
+FGameplayTag UTurnInPlace::GetTurnModeTag_Implementation() const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::GetTurnModeTag);
+	
+	// Determine the turn mode tag based on the character's movement settings
+	const bool bIsStrafing = MaybeCharacter && MaybeCharacter->GetCharacterMovement() && !MaybeCharacter->GetCharacterMovement()->bOrientRotationToMovement;
+	return bIsStrafing ? FTurnInPlaceTags::TurnMode_Strafe : FTurnInPlaceTags::TurnMode_Movement;
+}
+
+ETurnInPlaceEnabledState UTurnInPlace::GetEnabledState(const FTurnInPlaceParams& Params) const
+{
+	if (!HasValidData())
+	{
+		return ETurnInPlaceEnabledState::Locked;
+	}
+
+	// Determine the enabled state of turn in place
+	// This allows us to lock or pause turn in place, or force it to be enabled based on runtime conditions
+	const ETurnInPlaceEnabledState State = Params.State;
+	const ETurnInPlaceOverride OverrideState = OverrideTurnInPlace();
+	switch (OverrideState)
+	{
+	case ETurnInPlaceOverride::Default: return State;
+	case ETurnInPlaceOverride::ForceEnabled: return ETurnInPlaceEnabledState::Enabled;
+	case ETurnInPlaceOverride::ForceLocked: return ETurnInPlaceEnabledState::Locked;
+	case ETurnInPlaceOverride::ForcePaused: return ETurnInPlaceEnabledState::Paused;
+	default: return State;
+	}
+}
+
+FTurnInPlaceAnimSet UTurnInPlace::GetTurnInPlaceAnimSet() const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::GetTurnInPlaceAnimSet);
+
+	if (const FTurnInPlaceAnimSet* AnimSet = GetTurnInPlaceAnimSetDirect())
+	{
+		return *AnimSet;
+	}
+
+	if (AnimSetSource == ETurnAnimSetSource::DataAsset)
+	{
+		return FTurnInPlaceAnimSet();
+	}
+	return ITurnInPlaceAnimInterface::Execute_GetTurnInPlaceAnimSet(AnimInstance);
+}
+
+const FTurnInPlaceAnimSet* UTurnInPlace::GetTurnInPlaceAnimSetDirect() const
+{
+	if (AnimSetSource == ETurnAnimSetSource::Component)
+	{
+		return &ComponentAnimSet;
+	}
+
+	if (AnimSetSource == ETurnAnimSetSource::DataAsset)
+	{
+		const UTurnInPlaceAnimSetAsset* Asset = GetAnimSetAsset();
+		return Asset ? &Asset->AnimSet : nullptr;
+	}
+
+	return NativeAnimInstance ? &NativeAnimInstance->GetTurnInPlaceAnimSetRef() : nullptr;
+}
+
+FTurnInPlaceAnimSetSnapshotPtr UTurnInPlace::GetAnimSetSnapshot() const
+{
+	if (!HasValidData())
+	{
+		return FTurnInPlaceAnimSetSnapshot::GetDefault();
+	}
+
+	// Data assets build their snapshot once and share it, so switching between them is a pointer swap
+	if (AnimSetSource == ETurnAnimSetSource::DataAsset)
+	{
+		// Resolve the asset again when notified, or once per frame if it comes from the anim instance and we can't
+		// rely on being notified
+		const bool bPerFrame = AnimSetCacheMode == ETurnAnimSetCacheMode::PerFrame && !AnimSetAsset;
+		if (AnimSetAssetVersion != AnimSetVersion || !AnimSetSnapshot.IsValid() ||
+			(bPerFrame && AnimSetSnapshotFrame != GFrameCounter))
+		{
+			AnimSetAssetVersion = AnimSetVersion;
+			AnimSetSnapshotFrame = GFrameCounter;
+
+			UTurnInPlaceAnimSetAsset* Asset = GetAnimSetAsset();
+			FTurnInPlaceAnimSetSnapshotPtr AssetSnapshot = Asset ? Asset->GetSnapshot(Settings) : FTurnInPlaceAnimSetSnapshot::GetDefault();
+			if (AnimSetSnapshot != AssetSnapshot)
+			{
+				AnimSetSnapshot = MoveTemp(AssetSnapshot);
+				OnAnimSetSnapshotChanged(true);
+			}
+		}
+		return AnimSetSnapshot;
+	}
+
+	// Rebuild the snapshot if the anim set has changed, or once per frame if we can't rely on being notified of changes
+	// Anim sets that don't come from the anim instance can only change through us, so we're always notified
+	const bool bPerFrame = AnimSetCacheMode == ETurnAnimSetCacheMode::PerFrame && AnimSetSource == ETurnAnimSetSource::AnimInstance;
+	const bool bRebuild = !AnimSetSnapshot.IsValid() || AnimSetSnapshot->Version != AnimSetVersion ||
+		(bPerFrame && AnimSetSnapshotFrame != GFrameCounter);
+
+	if (bRebuild)
+	{
+		// Get the current turn in place anim set from the animation blueprint
+		// Only blueprint implementations of ITurnInPlaceAnimInterface need to copy it
+		FTurnInPlaceAnimSet AnimSetCopy;
+		const FTurnInPlaceAnimSet* DirectAnimSet = GetTurnInPlaceAnimSetDirect();
+		if (!DirectAnimSet)
+		{
+			AnimSetCopy = GetTurnInPlaceAnimSet();
+		}
+		const FTurnInPlaceAnimSet& AnimSet = DirectAnimSet ? *DirectAnimSet : AnimSetCopy;
+		AnimSetSnapshotFrame = GFrameCounter;
+
+		// PerFrame retrieves the anim set every frame, but it rarely changes, keep the snapshot unless it differs
+		const bool bVersionChanged = !AnimSetSnapshot.IsValid() || AnimSetSnapshot->Version != AnimSetVersion;
+		if (!bVersionChanged && AnimSetSnapshot->Matches(AnimSet, Settings))
+		{
+			return AnimSetSnapshot;
+		}
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::GetAnimSetSnapshot::Rebuild);
+		AnimSetSnapshot = MakeShared<const FTurnInPlaceAnimSetSnapshot, ESPMode::ThreadSafe>(AnimSet, Settings, AnimSetVersion);
+
+		// Only prewarm when the anim set was reported as changed
+		const bool bPrewarmCurves = PrewarmedSnapshotVersion != AnimSetVersion;
+		PrewarmedSnapshotVersion = AnimSetVersion;
+		OnAnimSetSnapshotChanged(bPrewarmCurves);
+	}
+
+	return AnimSetSnapshot;
+}
+
+void UTurnInPlace::OnAnimSetSnapshotChanged(bool bPrewarmCurves) const
+{
+	// Only report when the problems change, not every time the snapshot is rebuilt
+	if (AnimSetSnapshot->StepSizeWarnings != ReportedStepSizeWarnings)
+	{
+		ReportedStepSizeWarnings = AnimSetSnapshot->StepSizeWarnings;
+		ReportStepSizeWarnings(*AnimSetSnapshot);
+	}
+
+	// Bake the turn animations up front instead of mid-turn
+	if (bPrewarmCurves && bBakePseudoAnimCurves && WantsPseudoAnimState())
+	{
+		FTurnInPlaceCurveTableCache::Prewarm(AnimSetSnapshot->AnimSet, Settings);
+	}
+}
+
+void UTurnInPlace::ReportStepSizeWarnings(const FTurnInPlaceAnimSetSnapshot& Snapshot) const
+{
+	using EStepSizeWarning = FTurnInPlaceAnimSetSnapshot::EStepSizeWarning;
+	
+	const FString OwnerName = GetNameSafe(GetOwner());
+	if (EnumHasAnyFlags(Snapshot.StepSizeWarnings, EStepSizeWarning::Empty))
+	{
+		ensureMsgf(false, TEXT("No StepSizes found in TurnInPlaceParams"));
+		UE_LOG(LogTurnInPlace, Warning, TEXT("%s: No StepSizes found in TurnInPlaceParams"), *OwnerName);
+	}
+	if (EnumHasAnyFlags(Snapshot.StepSizeWarnings, EStepSizeWarning::Unsorted))
+	{
+		UE_LOG(LogTurnInPlace, Warning, TEXT("%s: StepSizes in TurnInPlaceParams are not sorted from lowest to highest"), *OwnerName);
+	}
+	if (EnumHasAnyFlags(Snapshot.StepSizeWarnings, EStepSizeWarning::OutOfRange))
+	{
+		UE_LOG(LogTurnInPlace, Warning, TEXT("%s: StepSizes in TurnInPlaceParams must be between 0 and 180"), *OwnerName);
+	}
+	if (EnumHasAnyFlags(Snapshot.StepSizeWarnings, EStepSizeWarning::LeftTurnsCount))
+	{
+		UE_LOG(LogTurnInPlace, Warning, TEXT("%s: TurnInPlaceAnimSet has %d LeftTurns but %d StepSizes"), *OwnerName,
+			Snapshot.AnimSet.LeftTurns.Num(), Snapshot.GetParams().StepSizes.Num());
+	}
+	if (EnumHasAnyFlags(Snapshot.StepSizeWarnings, EStepSizeWarning::RightTurnsCount))
+	{
+		UE_LOG(LogTurnInPlace, Warning, TEXT("%s: TurnInPlaceAnimSet has %d RightTurns but %d StepSizes"), *OwnerName,
+			Snapshot.AnimSet.RightTurns.Num(), Snapshot.GetParams().StepSizes.Num());
+	}
+}
+
+void UTurnInPlace::SetComponentAnimSet(const FTurnInPlaceAnimSet& InAnimSet)
+{
+	ComponentAnimSet = InAnimSet;
+	NotifyAnimSetChanged();
+}
+
+void UTurnInPlace::SetAnimSetAsset(UTurnInPlaceAnimSetAsset* InAnimSetAsset)
+{
+	AnimSetAsset = InAnimSetAsset;
+	NotifyAnimSetChanged();
+}
+
+UTurnInPlaceAnimSetAsset* UTurnInPlace::GetAnimSetAsset() const
+{
+	if (AnimSetAsset)
+	{
+		return AnimSetAsset;
+	}
+	if (NativeAnimInstance)
+	{
+		return NativeAnimInstance->GetTurnInPlaceAnimSetAsset_Implementation();
+	}
+	return bIsValidAnimInstance ? ITurnInPlaceAnimInterface::Execute_GetTurnInPlaceAnimSetAsset(AnimInstance) : nullptr;
+}
+
+bool UTurnInPlace::IsAnimationFree() const
+{
+	// Data assets can come from the anim instance, in which case we still need it
+	const bool bAnimSetFromComponent = AnimSetSource == ETurnAnimSetSource::Component ||
+		(AnimSetSource == ETurnAnimSetSource::DataAsset && AnimSetAsset != nullptr);
+	return bAnimSetFromComponent && WantsPseudoAnimState();
+}
+
+void UTurnInPlace::NotifyAnimSetChanged()
+{
+	// The snapshot will be rebuilt the next time it is requested
+	++AnimSetVersion;
+	InvalidateFrameContext();
+}
+
+const FTurnInPlaceParams& UTurnInPlace::GetParams() const
+{
+	return GetAnimSetSnapshot()->GetParams();
+}
+
+const FTurnInPlaceFrameContext& UTurnInPlace::GetFrameContext() const
+{
+	if (FrameContext.IsValidForFrame(GFrameCounter))
+	{
+		return FrameContext;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::GetFrameContext);
+
+	FrameContextBuildCount++;
+	FrameContext = {};
+	FrameContext.bHasValidData = HasValidData();
+	FrameContext.Snapshot = GetAnimSetSnapshot();
+	if (FrameContext.bHasValidData)
+	{
+		FrameContext.CurveValues = GetCurveValues();
+		FrameContext.TurnModeTag = GetTurnModeTag();
+		FrameContext.TurnModeIndex = ResolveTurnModeIndex(FrameContext.TurnModeTag, *FrameContext.Snapshot);
+	}
+
+	// Mark as valid before resolving the enabled state, OverrideTurnInPlace() reads the curve values from the context
+	FrameContext.Frame = GFrameCounter;
+	FrameContext.EnabledState = GetEnabledState(FrameContext.GetParams());
+
+	// GetCurveValues() already read the procedural turn, it is advanced by TurnInPlace()
+	FrameContext.bProceduralTurn = FrameContext.bHasValidData && IsProceduralTurn();
+
+	return FrameContext;
+}
+
+int32 UTurnInPlace::ResolveTurnModeIndex(const FGameplayTag& TurnModeTag, const FTurnInPlaceAnimSetSnapshot& Snapshot) const
+{
+	// Registered indices never change, an unregistered tag may have been registered by a snapshot built since
+	const bool bSnapshotChanged = CachedTurnModeIndex == INDEX_NONE && CachedTurnModeSnapshotId != Snapshot.SnapshotId;
+	if (CachedTurnModeTag != TurnModeTag || bSnapshotChanged)
+	{
+		CachedTurnModeTag = TurnModeTag;
+		CachedTurnModeSnapshotId = Snapshot.SnapshotId;
+		CachedTurnModeIndex = FTurnInPlaceTags::FindTurnModeIndex(TurnModeTag);
+	}
+	return CachedTurnModeIndex;
+}
+
+void UTurnInPlace::AdvanceProceduralTurn(float DeltaTime)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::OverrideTurnInPlace);
-	
-#if !UE_BUILD_SHIPPING
-	if (TurnInPlaceCvars::OverrideTurnInPlace > 0)
+	// TurnInPlace() can run several times a frame, e.g. once for each ServerMove received
+	if (ProceduralTurnFrame == GFrameCounter)
 	{
-		switch (TurnInPlaceCvars::OverrideTurnInPlace)
-		{
-		case 1: return ETurnInPlaceOverride::ForceEnabled;
-		case 2: return ETurnInPlaceOverride::ForceLocked;
-		case 3: return ETurnInPlaceOverride::ForcePaused;
-		default: break;
-		}
+		return;
 	}
-#endif
-
-	// Curve values are used to determine if we should pause or lock turn in place
-	const FTurnInPlaceCurveValues& CurveValues = GetCurveValues();
+	ProceduralTurnFrame = GFrameCounter;
 
-	if (FMath::IsNearlyEqual(CurveValues.PauseTurnInPlace, 1.f, 0.05f))
+	// Procedural turns and turn animations produce unrelated curves, the delta between them must not be applied
+	const FTurnInPlaceFrameContext& Context = GetFrameContext();
+	if (Context.bProceduralTurn != bWasProceduralTurn)
 	{
-		// We want to pause turn in place if the weight curve is not 0
-		return ETurnInPlaceOverride::ForcePaused;
+		bWasProceduralTurn = Context.bProceduralTurn;
+		TurnData.bLastUpdateValidCurveValue = false;
 	}
 
-	if (FMath::IsNearlyEqual(CurveValues.LockTurnInPlace, 1.f, 0.05f))
+	if (!Context.bProceduralTurn)
 	{
-		// We want to lock turn in place if the weight curve is not 0
-		return ETurnInPlaceOverride::ForceLocked;
+		ProceduralTurn = {};
+		return;
 	}
 
-	// We want to pause turn in place when using root motion montages
-	if (const UAnimMontage* Montage = GetCurrentNetworkRootMotionMontage())
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::AdvanceProceduralTurn);
+
+	// The frame context was built from the procedural turn before it advanced
+	ON_SCOPE_EXIT
 	{
-		// But we don't want to pause turn in place if the montage is ignored by our current params
-		if (!ShouldIgnoreRootMotionMontage(Montage))
-		{
-			return ETurnInPlaceOverride::ForcePaused;
-		}
-	}
+		FrameContext.CurveValues = ProceduralTurn.GetCurveValues();
+	};
 
-	return ETurnInPlaceOverride::Default;
-}
+	const FTurnInPlaceAnimSetSnapshot& Snapshot = *Context.Snapshot;
+	const FTurnInPlaceAnimSet& AnimSet = Snapshot.AnimSet;
+	const FTurnInPlaceAngles* TurnAngles = Context.GetTurnAngles();
+	const float TurnOffset = GetTurnOffset();
 
-FGameplayTag UTurnInPlace::GetTurnModeTag_Implementation() const
-{
-	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::GetTurnModeTag);
-	
-	// Determine the turn mode tag based on the character's movement settings
-	const bool bIsStrafing = MaybeCharacter && MaybeCharacter->GetCharacterMovement() && !MaybeCharacter->GetCharacterMovement()->bOrientRotationToMovement;
-	return bIsStrafing ? FTurnInPlaceTags::TurnMode_Strafe : FTurnInPlaceTags::TurnMode_Movement;
-}
+	// The turn completed last frame, or we became unable to turn in place during it
+	const bool bAbortTurn = Context.EnabledState != ETurnInPlaceEnabledState::Enabled && CanAbortTurnAnimation();
+	if (ProceduralTurn.bIsTurning && (ProceduralTurn.RemainingTurnYaw == 0.f || bAbortTurn))
+	{
+		ProceduralTurn = {};
+	}
 
-ETurnInPlaceEnabledState UTurnInPlace::GetEnabledState(const FTurnInPlaceParams& Params) const
-{
-	if (!HasValidData())
+	if (ProceduralTurn.bIsTurning)
 	{
-		return ETurnInPlaceEnabledState::Locked;
+		// Apply the same play rate changes as the turn animation, @see UTurnInPlaceStatics::GetTurnInPlacePlayRate_ThreadSafe
+		const bool bAtMaxAngle = TurnAngles && TurnAngles->MaxTurnAngle > 0.f && FMath::IsNearlyEqual(FMath::Abs(TurnOffset), TurnAngles->MaxTurnAngle);
+		const bool bDirectionChange = TurnOffset != 0.f && FMath::Sign(TurnOffset) != FMath::Sign(ProceduralTurn.RemainingTurnYaw);
+		const float PlayRate = FMath::Max(bAtMaxAngle ? AnimSet.PlayRateAtMaxAngle : 1.f,
+			bDirectionChange ? AnimSet.PlayRateOnDirectionChange : 1.f);
+
+		const float Remaining = FMath::Max(0.f, FMath::Abs(ProceduralTurn.RemainingTurnYaw) - ProceduralTurn.TurnRate * PlayRate * DeltaTime);
+		ProceduralTurn.RemainingTurnYaw = FMath::Sign(ProceduralTurn.RemainingTurnYaw) * Remaining;
+		return;
 	}
 
-	// Determine the enabled state of turn in place
-	// This allows us to lock or pause turn in place, or force it to be enabled based on runtime conditions
-	const ETurnInPlaceEnabledState State = Params.State;
-	const ETurnInPlaceOverride OverrideState = OverrideTurnInPlace();
-	switch (OverrideState)
+	// Start a turn under the same conditions as the anim graph, @see UpdateAnimGraphData()
+	const FTurnInPlaceParams& Params = Snapshot.GetParams();
+	if (Context.EnabledState == ETurnInPlaceEnabledState::Locked || Params.StepSizes.Num() == 0 ||
+		!TurnAngles || FMath::Abs(TurnOffset) < TurnAngles->MinTurnAngle)
 	{
-	case ETurnInPlaceOverride::Default: return State;
-	case ETurnInPlaceOverride::ForceEnabled: return ETurnInPlaceEnabledState::Enabled;
-	case ETurnInPlaceOverride::ForceLocked: return ETurnInPlaceEnabledState::Locked;
-	case ETurnInPlaceOverride::ForcePaused: return ETurnInPlaceEnabledState::Paused;
-	default: return State;
+		return;
 	}
-}
 
-FTurnInPlaceAnimSet UTurnInPlace::GetTurnInPlaceAnimSet() const
-{
-	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::GetTurnInPlaceAnimSet);
-	
-	return ITurnInPlaceAnimInterface::Execute_GetTurnInPlaceAnimSet(AnimInstance);
-}
+	bool bTurnRight = false;
+	const int32 StepSize = Snapshot.DetermineStepSize(TurnOffset, bTurnRight);
+	const TArray<TObjectPtr<UAnimSequence>>& TurnAnimations = bTurnRight ? AnimSet.RightTurns : AnimSet.LeftTurns;
+	const UAnimSequence* TurnAnimation = TurnAnimations.IsValidIndex(StepSize) ? TurnAnimations[StepSize].Get() : nullptr;
 
-FTurnInPlaceParams UTurnInPlace::GetParams() const
-{
-	if (!HasValidData())
+	// The turn rate is baked once per animation and shared, the animation isn't sampled while turning
+	const FTurnInPlaceCurveTablePtr Table = FTurnInPlaceCurveTableCache::FindOrBake(TurnAnimation, Settings);
+	if (!Table.IsValid() || Table->TurnRate <= 0.f)
 	{
-		return {};
+		return;
 	}
 
-	// Get the current turn in place parameters from the animation blueprint
-	FTurnInPlaceAnimSet AnimSet = GetTurnInPlaceAnimSet();
-	return AnimSet.Params;
+	ProceduralTurn.bIsTurning = true;
+	ProceduralTurn.TurnRate = Table->TurnRate;
+	ProceduralTurn.RemainingTurnYaw = bTurnRight ? Table->TotalTurnYaw : -Table->TotalTurnYaw;
+}
+
+void UTurnInPlace::InvalidateFrameContext()
+{
+	FrameContext.Frame = MAX_uint64;
 }
 
 FTurnInPlaceCurveValues UTurnInPlace::GetCurveValues() const
@@ -455,6 +1297,12 @@ FTurnInPlaceCurveValues UTurnInPlace::GetCurveValues() const
 		return {};
 	}
 
+	// Turning procedurally doesn't read any curves
+	if (IsProceduralTurn())
+	{
+		return ProceduralTurn.GetCurveValues();
+	}
+
 	// Dedicated server might want to use pseudo anim state instead of playing actual animations
 	if (WantsPseudoAnimState())
 	{
@@ -462,6 +1310,19 @@ FTurnInPlaceCurveValues UTurnInPlace::GetCurveValues() const
 		{
 			TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::GetCurveValues::PseudoAnim);
 			
+			if (bBakePseudoAnimCurves)
+			{
+				// Resolve the table again only when the pseudo anim changes
+				if (!PseudoCurveTable.IsValid() || !PseudoCurveTable->Matches(PseudoAnim, Settings))
+				{
+					PseudoCurveTable = FTurnInPlaceCurveTableCache::FindOrBake(PseudoAnim, Settings);
+				}
+				if (PseudoCurveTable.IsValid())
+				{
+					return PseudoCurveTable->Evaluate(PseudoNodeData.AnimStateTime);
+				}
+			}
+
 			const float Yaw = PseudoAnim->EvaluateCurveData(Settings.TurnYawCurveName, PseudoNodeData.AnimStateTime);
 			const float Weight = PseudoAnim->EvaluateCurveData(Settings.TurnWeightCurveName, PseudoNodeData.AnimStateTime);
 			const float Pause = PseudoAnim->EvaluateCurveData(Settings.PauseTurnInPlaceCurveName, PseudoNodeData.AnimStateTime);
@@ -470,9 +1331,26 @@ FTurnInPlaceCurveValues UTurnInPlace::GetCurveValues() const
 		}
 	}
 
+	// Running without animation, the pseudo anim is our only source of curves
+	if (!bIsValidAnimInstance)
+	{
+		return {};
+	}
+
 	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::GetCurveValues);
 
+	// Prefer the curve values published by the anim graph, they can't be read mid-write
+	FTurnInPlaceCurveValues PublishedValues;
+	if (CurveChannel.Read(PublishedValues))
+	{
+		return PublishedValues;
+	}
+
 	// Get the current turn in place curve values from the animation blueprint
+	if (NativeAnimInstance)
+	{
+		return NativeAnimInstance->GetTurnInPlaceCurveValues_Implementation();
+	}
 	return ITurnInPlaceAnimInterface::Execute_GetTurnInPlaceCurveValues(AnimInstance);
 }
 
@@ -481,14 +1359,6 @@ bool UTurnInPlace::WantsPseudoAnimState() const
 	return GetNetMode() == NM_DedicatedServer && DedicatedServerAnimUpdateMode == ETurnAnimUpdateMode::Pseudo;
 }
 
-bool UTurnInPlace::HasValidData() const
-{
-	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::HasValidData);
-	
-	// We need a valid AnimInstance and Character to proceed, and the anim instance must implement the TurnInPlaceAnimInterface
-	return bIsValidAnimInstance && IsValid(GetOwner()) && !GetOwner()->IsPendingKillPending();
-}
-
 ETurnMethod UTurnInPlace::GetTurnMethod() const
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::GetTurnMethod);
@@ -526,9 +1396,56 @@ void UTurnInPlace::SimulateTurnInPlace()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::SimulateTurnInPlace);
 	
-	if (bSimulateAnimationCurves && HasValidData() && GetOwnerRole() == ROLE_SimulatedProxy && IsCharacterStationary())
+	if (GetOwnerRole() != ROLE_SimulatedProxy)
 	{
+		return;
+	}
+
+	// Simulated proxies don't receive PostTurnInPlace(), capture the anim graph inputs once we're done here instead
+	ON_SCOPE_EXIT
+	{
+		CaptureAnimGraphInputs();
+	};
+
+	// Predict the turn offset between replication updates
+	ExtrapolateSimulatedTurnOffset(GetWorld()->GetDeltaSeconds());
+
+	// The anim graph has started playing the turn from the last turn event, or can no longer start it
+	if (TurnEventStepSize != INDEX_NONE && (GetFrameContext().IsTurning() || !IsCharacterStationary()))
+	{
+		TurnEventStepSize = INDEX_NONE;
+	}
+
+	// Turn events rely on the curves to reconstruct the turn offset
+	const bool bSimulateCurves = bSimulateAnimationCurves || SimulatedReplicationMode == ETurnReplicationMode::TurnEvents;
+	if (!bSimulateCurves || !IsCharacterStationary())
+	{
+		return;
+	}
+
+	// Skip reading the curves entirely while throttled
+	// TurnInPlace() applies the curve delta since the last update, so nothing that was skipped is lost
+	// Procedural turns are cheap enough to update every frame
+	const ETurnUpdateTier Tier = IsProceduralTurn() ? ETurnUpdateTier::Full : GetUpdateTier();
+	float UpdateDeltaTime = 0.f;
+	if (!SimulateThrottle.Consume(Tier, SimulatedProxyUpdateLOD.ReducedUpdateInterval, GetWorld()->GetDeltaSeconds(), UpdateDeltaTime))
+	{
+		return;
+	}
+
+	// The curve may belong to a different turn by now, don't apply the delta from before we were frozen
+	if (SimulateThrottle.bWasFrozen)
+	{
+		SimulateThrottle.bWasFrozen = false;
+		TurnData.bLastUpdateValidCurveValue = false;
+	}
+
+	if (GetFrameContext().bHasValidData)
+	{
+		// The extrapolator needs to know how much of the change came from our own curves
+		const float LastTurnOffset = TurnData.TurnOffset;
 		TurnInPlace(FRotator::ZeroRotator, FRotator::ZeroRotator, true);
+		OffsetExtrapolator.AddCurveYaw(FMath::FindDeltaAngleDegrees(LastTurnOffset, TurnData.TurnOffset));
 	}
 }
 
@@ -536,19 +1453,37 @@ void UTurnInPlace::TurnInPlace(const FRotator& CurrentRotation, const FRotator&
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::TurnInPlace);
 
-	// Determine the correct params to use
-	const FTurnInPlaceParams Params = GetParams();
-	
+	// Advance the procedural turn before reading its curves
+	const UWorld* World = GetWorld();
+	AdvanceProceduralTurn(World ? World->GetDeltaSeconds() : 0.f);
+
 	// Determine the state of turn in place
-	const ETurnInPlaceEnabledState State = GetEnabledState(Params);
+	const FTurnInPlaceFrameContext& Context = GetFrameContext();
+	const ETurnInPlaceEnabledState State = Context.EnabledState;
 	
 	// Turn in place is locked, we can't do anything
 	const bool bEnabled = State != ETurnInPlaceEnabledState::Locked;
 	if (!bEnabled)
 	{
 		TurnData = {};
+		Quiescence.bValid = false;
+		bIsSleeping = false;
+		return;
+	}
+
+	// Nothing has changed since an evaluation that changed nothing, so this one won't change anything either
+	if (!bClientSimulation && TurnInPlaceCvars::bSkipIdleTurnInPlace &&
+		Quiescence.Matches(DesiredRotation.Yaw, CurrentRotation.Yaw, Context.CurveValues, State,
+		Context.Snapshot->SnapshotId, Context.TurnModeIndex, TurnData))
+	{
+		bIsSleeping = true;
+		INC_DWORD_STAT(STAT_TurnInPlaceSleeping);
 		return;
 	}
+	bIsSleeping = false;
+	INC_DWORD_STAT(STAT_TurnInPlaceAwake);
+
+	const FTurnInPlaceData LastTurnData = TurnData;
 
 	if (!bClientSimulation)
 	{
@@ -565,7 +1500,7 @@ void UTurnInPlace::TurnInPlace(const FRotator& CurrentRotation, const FRotator&
 	
 	// Apply any turning from the animation sequence
 	float LastCurveValue = TurnData.CurveValue;
-	const FTurnInPlaceCurveValues CurveValues = GetCurveValues();
+	const FTurnInPlaceCurveValues& CurveValues = Context.CurveValues;
 	const float TurnYawWeight = CurveValues.TurnYawWeight;
 
 	if (FMath::IsNearlyZero(TurnYawWeight, KINDA_SMALL_NUMBER))
@@ -606,11 +1541,10 @@ void UTurnInPlace::TurnInPlace(const FRotator& CurrentRotation, const FRotator&
 
 	// Clamp the turn in place to the max angle if provided; this prevents the character from under-rotating in
 	// relation to the control rotation which can cause the character to insufficiently face the camera in shooters
-	const FGameplayTag& TurnModeTag = GetTurnModeTag();
-	const FTurnInPlaceAngles* TurnAngles = Params.GetTurnAngles(TurnModeTag);
+	const FTurnInPlaceAngles* TurnAngles = Context.GetTurnAngles();
 	if (!TurnAngles)
 	{
-		UE_LOG(LogTurnInPlace, Warning, TEXT("No TurnAngles found for TurnModeTag: %s"), *TurnModeTag.ToString());
+		UE_LOG(LogTurnInPlace, Warning, TEXT("No TurnAngles found for TurnModeTag: %s"), *Context.TurnModeTag.ToString());
 	}
 
 	// Clamp the turn offset to the max angle if provided
@@ -626,7 +1560,25 @@ void UTurnInPlace::TurnInPlace(const FRotator& CurrentRotation, const FRotator&
 		const float ActorTurnRotation = FRotator::NormalizeAxis(DesiredRotation.Yaw - (TurnData.TurnOffset + CurrentRotation.Yaw));
 
 		// Apply the turn offset to the character
-		GetOwner()->SetActorRotation(CurrentRotation + FRotator(0.f,  ActorTurnRotation, 0.f));
+		const bool bRotationChanged = !FMath::IsNearlyZero(ActorTurnRotation, KINDA_SMALL_NUMBER);
+		if (bRotationChanged)
+		{
+			SetOwnerRotation(CurrentRotation + FRotator(0.f,  ActorTurnRotation, 0.f));
+		}
+
+		// If this changed nothing, then the same inputs next time won't change anything either
+		Quiescence.bValid = !bRotationChanged && TurnData == LastTurnData;
+		if (Quiescence.bValid)
+		{
+			Quiescence.DesiredYaw = DesiredRotation.Yaw;
+			Quiescence.CurrentYaw = CurrentRotation.Yaw;
+			Quiescence.TurnYawWeight = CurveValues.TurnYawWeight;
+			Quiescence.RemainingTurnYaw = CurveValues.RemainingTurnYaw;
+			Quiescence.EnabledState = State;
+			Quiescence.SnapshotId = Context.Snapshot->SnapshotId;
+			Quiescence.TurnModeIndex = Context.TurnModeIndex;
+			Quiescence.TurnData = TurnData;
+		}
 	}
 	
 #if !UE_BUILD_SHIPPING
@@ -640,6 +1592,85 @@ void UTurnInPlace::PostTurnInPlace(float LastTurnOffset)
 {
 	// Compress result and replicate to simulated proxy
 	CompressSimulatedTurnOffset(LastTurnOffset);
+
+	// The turn is resolved for this frame, hand it to the anim graph
+	CaptureAnimGraphInputs();
+}
+
+bool UTurnInPlace::SetOwnerRotation(const FRotator& NewRotation)
+{
+	const USceneComponent* RootComponent = GetOwner() ? GetOwner()->GetRootComponent() : nullptr;
+	if (!RootComponent)
+	{
+		return false;
+	}
+
+	// Already within a scoped movement update, nothing to gain by deferring
+	if (!bDeferRotationToMovement || !bCanDeferOwnerRotation || RootComponent->IsDeferringMovementUpdates())
+	{
+		return ApplyOwnerRotation(NewRotation);
+	}
+
+	// A previous frame's rotation was never flushed, don't let it linger any longer
+	if (bHasPendingOwnerRotation && PendingOwnerRotationFrame != GFrameCounter)
+	{
+		FlushPendingOwnerRotation();
+	}
+
+	PendingOwnerRotation = NewRotation;
+	PendingOwnerRotationFrame = GFrameCounter;
+	bHasPendingOwnerRotation = true;
+	return true;
+}
+
+FRotator UTurnInPlace::GetOwnerRotation() const
+{
+	return bHasPendingOwnerRotation ? PendingOwnerRotation : GetOwner()->GetActorRotation();
+}
+
+void UTurnInPlace::FlushPendingOwnerRotation()
+{
+	if (bHasPendingOwnerRotation)
+	{
+		bHasPendingOwnerRotation = false;
+		ApplyOwnerRotation(PendingOwnerRotation);
+	}
+}
+
+bool UTurnInPlace::ApplyOwnerRotation(const FRotator& NewRotation) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::ApplyOwnerRotation);
+
+	USceneComponent* RootComponent = GetOwner() ? GetOwner()->GetRootComponent() : nullptr;
+	if (!RootComponent)
+	{
+		return false;
+	}
+
+	if (ShouldSweepRotation(RootComponent->GetComponentRotation(), NewRotation))
+	{
+		INC_DWORD_STAT(STAT_TurnInPlaceSweptRotations);
+		return GetOwner()->SetActorRotation(NewRotation);
+	}
+
+	// This is AActor::SetActorRotation() without the sweep
+	INC_DWORD_STAT(STAT_TurnInPlaceUnsweptRotations);
+	return RootComponent->MoveComponent(FVector::ZeroVector, NewRotation, false);
+}
+
+bool UTurnInPlace::ShouldSweepRotation(const FRotator& CurrentRotation, const FRotator& NewRotation) const
+{
+	switch (RotationSweepHandling)
+	{
+	case ERotationSweepHandling::AutoDetect:
+		{
+			const FRotator Delta = (NewRotation - CurrentRotation).GetNormalized();
+			return !FMath::IsNearlyZero(Delta.Pitch, TURN_ROTATOR_TOLERANCE) || !FMath::IsNearlyZero(Delta.Roll, TURN_ROTATOR_TOLERANCE);
+		}
+	case ERotationSweepHandling::AlwaysSweep: return true;
+	case ERotationSweepHandling::NeverSweep: return false;
+	default: return true;
+	}
 }
 
 bool UTurnInPlace::FaceRotation(FRotator NewControlRotation, float DeltaTime)
@@ -653,28 +1684,34 @@ bool UTurnInPlace::FaceRotation(FRotator NewControlRotation, float DeltaTime)
 	}
 
 	// Invalid requirements, exit
-	if (!HasValidData() || !MaybeCharacter || !MaybeCharacter->GetCharacterMovement())
+	const FTurnInPlaceFrameContext& Context = GetFrameContext();
+	if (!Context.bHasValidData || !MaybeCharacter || !MaybeCharacter->GetCharacterMovement())
 	{
 		TurnData = {};
 		return true;
 	}
 	
 	// Determine the correct params to use
-	const FTurnInPlaceParams Params = GetParams();
+	const FTurnInPlaceParams& Params = Context.GetParams();
 	
 	// Determine the state of turn in place
-	const ETurnInPlaceEnabledState State = GetEnabledState(Params);
+	const ETurnInPlaceEnabledState State = Context.EnabledState;
 	
 	// Turn in place is locked, we can't do anything
 	const bool bEnabled = State != ETurnInPlaceEnabledState::Paused;
 	if (!bEnabled)
 	{
+		// ACharacter::FaceRotation() rotates from the actual rotation, so it can't be left pending
+		FlushPendingOwnerRotation();
 		TurnData = {};
 		return false;
 	}
 
+	// Rotations applied from here can be held until the movement component's scoped movement update
+	TGuardValue<bool> CanDeferGuard(bCanDeferOwnerRotation, true);
+
 	// Cache the current rotation
-	const FRotator CurrentRotation = GetOwner()->GetActorRotation();
+	const FRotator CurrentRotation = GetOwnerRotation();
 
 	// If the character is stationary, we can turn in place
 	if (IsCharacterStationary())
@@ -718,7 +1755,7 @@ bool UTurnInPlace::FaceRotation(FRotator NewControlRotation, float DeltaTime)
 			}
 #endif
 
-			GetOwner()->SetActorRotation(NewControlRotation);
+			SetOwnerRotation(NewControlRotation);
 		}
 	}
 	return true;
@@ -736,17 +1773,15 @@ bool UTurnInPlace::PhysicsRotation(UCharacterMovementComponent* CharacterMovemen
 	}
 	
 	// Invalid requirements, exit
-	if (!HasValidData() || !MaybeCharacter || !MaybeCharacter->GetCharacterMovement())
+	const FTurnInPlaceFrameContext& Context = GetFrameContext();
+	if (!Context.bHasValidData || !MaybeCharacter || !MaybeCharacter->GetCharacterMovement())
 	{
 		TurnData = {};
 		return true;
 	}
 
-	// Determine the correct params to use
-	const FTurnInPlaceParams Params = GetParams();
-	
 	// Determine the state of turn in place
-	const ETurnInPlaceEnabledState State = GetEnabledState(Params);
+	const ETurnInPlaceEnabledState State = Context.EnabledState;
 	
 	// Turn in place is locked, we can't do anything
 	const bool bEnabled = State != ETurnInPlaceEnabledState::Paused;
@@ -792,40 +1827,108 @@ bool UTurnInPlace::PhysicsRotation(UCharacterMovementComponent* CharacterMovemen
 }
 
 FTurnInPlaceAnimGraphData UTurnInPlace::UpdateAnimGraphData(float DeltaTime) const
+{
+	return BuildAnimGraphData(GatherAnimGraphInputs());
+}
+
+FTurnInPlaceAnimGraphInputs UTurnInPlace::GatherAnimGraphInputs() const
+{
+	FTurnInPlaceAnimGraphInputs Inputs;
+	const FTurnInPlaceFrameContext& Context = GetFrameContext();
+	if (!Context.bHasValidData)
+	{
+		return Inputs;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::GatherAnimGraphInputs);
+
+	Inputs.bHasValidData = true;
+	Inputs.Frame = Context.Frame;
+	Inputs.AnimSet = Context.Snapshot;
+	Inputs.TurnOffset = GetTurnOffset();
+	Inputs.bIsTurning = Context.IsTurning();
+	Inputs.EnabledState = Context.EnabledState;
+	Inputs.TurnModeTag = Context.TurnModeTag;
+	Inputs.TurnModeIndex = Context.TurnModeIndex;
+	Inputs.bWantsPseudoAnimState = WantsPseudoAnimState();
+	Inputs.UpdateTier = Inputs.bWantsPseudoAnimState ? GetUpdateTier() : ETurnUpdateTier::Full;
+	Inputs.bProceduralTurn = Context.bProceduralTurn;
+	Inputs.bIsStationary = IsCharacterStationary();
+
+	// Abort the turn if we became unable to turn in place during a turn
+	Inputs.bAbortTurn = Inputs.EnabledState != ETurnInPlaceEnabledState::Enabled && CanAbortTurnAnimation();
+
+	// Same as UTurnInPlaceAnimInstance::IsStrafing(), resolved here so the anim graph doesn't need the movement component
+	const UCharacterMovementComponent* Movement = MaybeCharacter ? MaybeCharacter->GetCharacterMovement() : nullptr;
+	Inputs.bIsStrafing = Movement && !Movement->bOrientRotationToMovement;
+
+	// A turn started by a turn event that the anim graph hasn't started playing yet
+	Inputs.TurnEventStepSize = TurnEventStepSize;
+	Inputs.bTurnEventTurnRight = bTurnEventTurnRight;
+	Inputs.TurnEventStartTime = TurnEventStartTime;
+
+	return Inputs;
+}
+
+void UTurnInPlace::CaptureAnimGraphInputs()
+{
+	AnimGraphInputs = GatherAnimGraphInputs();
+}
+
+void UTurnInPlace::CaptureAnimGraphInputsIfStale()
+{
+	if (AnimGraphInputs.Frame != GFrameCounter)
+	{
+		CaptureAnimGraphInputs();
+	}
+}
+
+FTurnInPlaceAnimGraphData UTurnInPlace::BuildAnimGraphData(const FTurnInPlaceAnimGraphInputs& Inputs)
 {
 	FTurnInPlaceAnimGraphData AnimGraphData;
-	if (!HasValidData())
+	if (!Inputs.bHasValidData)
 	{
 		return AnimGraphData;
 	}
 
-	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::UpdateAnimGraphData);
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::BuildAnimGraphData);
 
 	// Get the current turn in place anim set & parameters from the animation blueprint
-	AnimGraphData.AnimSet = GetTurnInPlaceAnimSet();
-	const FTurnInPlaceParams Params = AnimGraphData.AnimSet.Params;
+	const FTurnInPlaceAnimSetSnapshot& Snapshot = Inputs.AnimSet.Get();
+	const FTurnInPlaceParams& Params = Snapshot.GetParams();
+	AnimGraphData.AnimSetHandle = Inputs.AnimSet;
 
 	// Determine the enabled state of turn in place
-	const ETurnInPlaceEnabledState State = GetEnabledState(Params);
+	const ETurnInPlaceEnabledState State = Inputs.EnabledState;
 
 	// Retrieve parameters for the current frame required by the animation graph
-	const float& TurnOffset = GetTurnOffset();
+	const float TurnOffset = Inputs.TurnOffset;
 	AnimGraphData.TurnOffset = TurnOffset;
-	AnimGraphData.bIsTurning = IsTurningInPlace();
-	AnimGraphData.StepSize = DetermineStepSize(Params, TurnOffset, AnimGraphData.bTurnRight);
-	AnimGraphData.TurnModeTag = GetTurnModeTag();
-	AnimGraphData.bWantsPseudoAnimState = WantsPseudoAnimState();
-
-	// Abort the turn if we became unable to turn in place during a turn
-	AnimGraphData.bAbortTurn = State != ETurnInPlaceEnabledState::Enabled && CanAbortTurnAnimation();
+	AnimGraphData.bIsTurning = Inputs.bIsTurning;
+	AnimGraphData.StepSize = DetermineStepSize(Snapshot, TurnOffset, AnimGraphData.bTurnRight);
+	AnimGraphData.TurnModeTag = Inputs.TurnModeTag;
+	AnimGraphData.bWantsPseudoAnimState = Inputs.bWantsPseudoAnimState;
+	AnimGraphData.UpdateTier = Inputs.UpdateTier;
+	AnimGraphData.bProceduralTurn = Inputs.bProceduralTurn;
+	AnimGraphData.bAbortTurn = Inputs.bAbortTurn;
+	AnimGraphData.bIsStrafing = Inputs.bIsStrafing;
+
+	// The server already started a turn, play the same one from where the server is at
+	const bool bTurnEvent = Inputs.TurnEventStepSize != INDEX_NONE;
+	if (bTurnEvent)
+	{
+		AnimGraphData.StepSize = Inputs.TurnEventStepSize;
+		AnimGraphData.bTurnRight = Inputs.bTurnEventTurnRight;
+		AnimGraphData.TurnStartTime = Inputs.TurnEventStartTime;
+	}
 
 	// Determine if we have valid turn angles for the current turn mode tag and cache the result
-	if (const FTurnInPlaceAngles* TurnAngles = Params.GetTurnAngles(GetTurnModeTag()))
+	if (const FTurnInPlaceAngles* TurnAngles = Snapshot.FindTurnAnglesFast(Inputs.TurnModeIndex))
 	{
 		AnimGraphData.TurnAngles = *TurnAngles;
 		AnimGraphData.bHasValidTurnAngles = true;
 		AnimGraphData.bWantsToTurn = State != ETurnInPlaceEnabledState::Locked && Params.StepSizes.Num() > 0 &&
-			FMath::Abs(TurnOffset) >= TurnAngles->MinTurnAngle;
+			(bTurnEvent || FMath::Abs(TurnOffset) >= TurnAngles->MinTurnAngle);
 	}
 	else
 	{
@@ -853,7 +1956,21 @@ void UTurnInPlace::UpdatePseudoAnimState(float DeltaTime, const FTurnInPlaceAnim
 		return;
 	}
 
-	if (!HasValidData())
+	// UTurnInPlaceWorldSubsystem is already advancing our pseudo anim state
+	if (!HasValidData() || IsPseudoAnimStateBatched())
+	{
+		return;
+	}
+
+	// Procedural turns don't use the pseudo anim state, it resumes when we return to animated turns
+	if (TurnAnimData.bProceduralTurn)
+	{
+		return;
+	}
+
+	float StepDeltaTime = 0.f;
+	bool bResumed = false;
+	if (!ConsumePseudoAnimDeltaTime(TurnAnimData.UpdateTier, DeltaTime, StepDeltaTime, bResumed))
 	{
 		return;
 	}
@@ -861,69 +1978,42 @@ void UTurnInPlace::UpdatePseudoAnimState(float DeltaTime, const FTurnInPlaceAnim
 	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlace::UpdatePseudoAnimState);
 
 	// Update pseudo state on dedicated server
-	const FTurnInPlaceAnimSet& AnimSet = TurnAnimData.AnimSet;
+	UTurnInPlaceStatics::StepPseudoAnimState(StepDeltaTime, TurnAnimData, TurnOutput, PseudoAnimState, PseudoNodeData, PseudoAnim);
+}
 
-	switch (PseudoAnimState)
+bool UTurnInPlace::ConsumePseudoAnimDeltaTime(ETurnUpdateTier Tier, float DeltaTime, float& OutDeltaTime, bool& bOutResumed)
+{
+	bOutResumed = false;
+	if (!PseudoThrottle.Consume(Tier, ServerUpdateLOD.ReducedUpdateInterval, DeltaTime, OutDeltaTime))
 	{
-	case ETurnPseudoAnimState::Idle:
-		if (TurnOutput.bWantsToTurn)
-		{
-			PseudoAnimState = ETurnPseudoAnimState::TurnInPlace;
-
-			// SetupTurnAnim()
-			PseudoNodeData.StepSize = TurnAnimData.StepSize;
-			PseudoNodeData.bIsTurningRight = TurnAnimData.bTurnRight;
-
-			// SetupTurnInPlace()
-			PseudoNodeData.AnimStateTime = 0.f;
-			PseudoAnim = UTurnInPlaceStatics::GetTurnInPlaceAnimation(AnimSet, PseudoNodeData, false);
-			PseudoNodeData.bHasReachedMaxTurnAngle = false;
-			UTurnInPlaceStatics::ThreadSafeUpdateTurnInPlaceNode(PseudoNodeData, TurnAnimData, AnimSet);
-		}
-		break;
-	case ETurnPseudoAnimState::TurnInPlace:
-		if (TurnOutput.bAbortTurn)
-		{
-			PseudoAnimState = ETurnPseudoAnimState::Idle;
+		return false;
+	}
 
-			// SetupIdle()
-			PseudoNodeData.TurnPlayRate = 1.f;
-			PseudoNodeData.bHasReachedMaxTurnAngle = false;
-		}
-		else if (TurnOutput.bWantsTurnRecovery)
-		{
-			PseudoAnimState = ETurnPseudoAnimState::Recovery;
+	// The turn we were frozen in is long gone, start over from Idle and don't apply the delta from before we were frozen
+	if (PseudoThrottle.bWasFrozen)
+	{
+		PseudoThrottle.bWasFrozen = false;
+		TurnData.bLastUpdateValidCurveValue = false;
+		PseudoAnimState = ETurnPseudoAnimState::Idle;
+		PseudoNodeData = {};
+		PseudoAnim = nullptr;
+		bOutResumed = true;
+	}
+	return true;
+}
 
-			// SetupTurnRecovery() -- AnimStateTime is already carried over from TurnInPlace
-			PseudoNodeData.bIsRecoveryTurningRight = PseudoNodeData.bIsTurningRight;
-			PseudoAnim = UTurnInPlaceStatics::GetTurnInPlaceAnimation(AnimSet, PseudoNodeData, true);
-		}
-		else
-		{
-			// UpdateTurnInPlace()
-			PseudoAnim = UTurnInPlaceStatics::GetTurnInPlaceAnimation(AnimSet, PseudoNodeData, false);
-			PseudoNodeData.AnimStateTime = UTurnInPlaceStatics::GetUpdatedTurnInPlaceAnimTime_ThreadSafe(PseudoAnim,
-				PseudoNodeData.AnimStateTime, DeltaTime, PseudoNodeData.TurnPlayRate);
-			UTurnInPlaceStatics::ThreadSafeUpdateTurnInPlaceNode(PseudoNodeData, TurnAnimData, AnimSet);
-		}
-		break;
-	case ETurnPseudoAnimState::Recovery:
-		{
-			// UpdateTurnInPlaceRecovery()
-			PseudoAnim = UTurnInPlaceStatics::GetTurnInPlaceAnimation(AnimSet, PseudoNodeData, true);
-			PseudoNodeData.AnimStateTime = UTurnInPlaceStatics::GetUpdatedTurnInPlaceAnimTime_ThreadSafe(PseudoAnim,
-				PseudoNodeData.AnimStateTime, DeltaTime, 1.f);  // Recovery plays at 1x speed
-			if (!PseudoAnim || (PseudoAnim && PseudoNodeData.AnimStateTime >= PseudoAnim->GetPlayLength()))
-			{
-				PseudoAnimState = ETurnPseudoAnimState::Idle;
+void UTurnInPlace::ApplyBatchedPseudoAnimState(ETurnPseudoAnimState InState, const FTurnInPlaceGraphNodeData& InNodeData,
+	UAnimSequence* InAnim)
+{
+	PseudoAnimState = InState;
+	PseudoNodeData = InNodeData;
+	PseudoAnim = InAnim;
+}
 
-				// SetupIdle()
-				PseudoNodeData.TurnPlayRate = 1.f;
-				PseudoNodeData.bHasReachedMaxTurnAngle = false;
-			}
-		}
-		break;
-	}
+int32 UTurnInPlace::DetermineStepSize(const FTurnInPlaceAnimSetSnapshot& Snapshot, float Angle, bool& bTurnRight)
+{
+	// Step sizes are compiled into a lookup table when the snapshot is built
+	return Snapshot.DetermineStepSize(Angle, bTurnRight);
 }
 
 int32 UTurnInPlace::DetermineStepSize(const FTurnInPlaceParams& Params, float Angle, bool& bTurnRight)
@@ -944,43 +2034,7 @@ int32 UTurnInPlace::DetermineStepSize(const FTurnInPlaceParams& Params, float An
 		return 0;
 	}
 
-	// Determine the step size based on the select mode
-	int32 StepSize = 0;
-	switch(Params.SelectMode)
-	{
-	case ETurnAnimSelectMode::Nearest:
-		{
-			// Find the animation nearest to the angle
-			float Diff = 0.f;
-			for (int32 i = 0; i < Params.StepSizes.Num(); i++)
-			{
-				const int32& TAngle = Params.StepSizes[i];
-				const float AngleDiff = FMath::Abs(StepAngle - (float)TAngle);
-				if (i == 0 || AngleDiff < Diff)
-				{
-					Diff = AngleDiff;
-					StepSize = i;
-				}
-			}
-		}
-		break;
-	case ETurnAnimSelectMode::Greater:
-		{
-			// Find the highest animation that exceeds the angle
-			for (int32 i = 0; i < Params.StepSizes.Num(); i++)
-			{
-				const int32& TAngle = Params.StepSizes[i];
-				if (FMath::FloorToInt(StepAngle) >= TAngle)
-				{
-					StepSize = i;
-				}
-			}
-		}
-		break;
-	default: ;
-	}
-
-	return StepSize;
+	return FTurnInPlaceAnimSetSnapshot::SelectStepSize(Params, StepAngle);
 }
 
 void UTurnInPlace::DebugRotation() const
@@ -1055,7 +2109,7 @@ void UTurnInPlace::DebugServerPhysicsBodies() const
 	if (bDrawServerPhysicsBodies && PawnOwner && GetOwner()->GetLocalRole() == ROLE_Authority && GetNetMode() != NM_Standalone)
 	{
 #if WITH_SIMPLE_ANIMATION
-		USimpleAnimLib::DrawPawnDebugPhysicsBodies(PawnOwner, GetMesh(), true, false, false);
+		USimpleAnimLib::DrawPawnDebugPhysicsBodies(PawnOwner, CachedMesh, true, false, false);
 #else
 		if (!bHasWarnedSimpleAnimation)
 		{
@@ -0,0 +1,80 @@
+﻿// Copyright (c) 2025 Jared Taylor
+
+
+#include "TurnInPlaceAnimSetAsset.h"
+
+#include "Misc/ScopeRWLock.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(TurnInPlaceAnimSetAsset)
+
+FTurnInPlaceAnimSetSnapshotPtr UTurnInPlaceAnimSetAsset::GetSnapshot(const FTurnInPlaceSettings& Settings)
+{
+	{
+		FReadScopeLock ReadLock(SnapshotLock);
+		for (const FTurnInPlaceAnimSetSnapshotPtr& Snapshot : Snapshots)
+		{
+			if (Snapshot->Settings == Settings)
+			{
+				return Snapshot;
+			}
+		}
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlaceAnimSetAsset::GetSnapshot::Build);
+	
+	// First time these curve names have been requested
+	FWriteScopeLock WriteLock(SnapshotLock);
+	for (const FTurnInPlaceAnimSetSnapshotPtr& Snapshot : Snapshots)
+	{
+		if (Snapshot->Settings == Settings)
+		{
+			return Snapshot;
+		}
+	}
+	return Snapshots.Add_GetRef(MakeShared<const FTurnInPlaceAnimSetSnapshot, ESPMode::ThreadSafe>(AnimSet, Settings, 0));
+}
+
+void UTurnInPlaceAnimSetAsset::PostLoad()
+{
+	Super::PostLoad();
+
+	RebuildSnapshots();
+}
+
+#if WITH_EDITOR
+FOnTurnInPlaceAnimSetAssetChanged UTurnInPlaceAnimSetAsset::OnAnimSetAssetChanged;
+
+void UTurnInPlaceAnimSetAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	RebuildSnapshots();
+
+	// Components cache the asset's snapshot until notified, @see UTurnInPlace::NotifyAnimSetChanged()
+	OnAnimSetAssetChanged.Broadcast(this);
+}
+#endif
+
+void UTurnInPlaceAnimSetAsset::RebuildSnapshots()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlaceAnimSetAsset::RebuildSnapshots);
+	
+	FWriteScopeLock WriteLock(SnapshotLock);
+
+	// Keep building the curve names that have been requested, they're likely to be requested again
+	TArray<FTurnInPlaceSettings, TInlineAllocator<1>> SnapshotSettings;
+	for (const FTurnInPlaceAnimSetSnapshotPtr& Snapshot : Snapshots)
+	{
+		SnapshotSettings.Add(Snapshot->Settings);
+	}
+	if (SnapshotSettings.IsEmpty())
+	{
+		SnapshotSettings.Add(FTurnInPlaceSettings());
+	}
+
+	Snapshots.Reset();
+	for (const FTurnInPlaceSettings& Settings : SnapshotSettings)
+	{
+		Snapshots.Add(MakeShared<const FTurnInPlaceAnimSetSnapshot, ESPMode::ThreadSafe>(AnimSet, Settings, 0));
+	}
+}
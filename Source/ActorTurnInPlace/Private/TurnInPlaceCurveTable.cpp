@@ -0,0 +1,206 @@
+﻿// Copyright (c) 2025 Jared Taylor
+
+
+#include "TurnInPlaceCurveTable.h"
+
+#include "Animation/AnimSequence.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace TurnInPlaceCurveTableCvars
+{
+	static float CurveBakeRate = 60.f;
+	FAutoConsoleVariableRef CVarCurveBakeRate(
+		TEXT("p.Turn.Pseudo.CurveBakeRate"),
+		CurveBakeRate,
+		TEXT("Samples per second used when baking turn animation curves for pseudo anim evaluation. Only affects animations baked after it is changed"),
+		ECVF_Default);
+
+	/** RemainingTurnYaw at or below this is considered to have completed the turn */
+	static constexpr float TurnCompleteTolerance = 0.01f;
+}
+
+namespace TurnInPlaceCurveTableCache
+{
+	struct FKey
+	{
+		FKey(const UAnimSequence* InSequence, const FTurnInPlaceSettings& InSettings)
+			: Sequence(InSequence)
+			, TurnYawCurveName(InSettings.TurnYawCurveName)
+			, TurnWeightCurveName(InSettings.TurnWeightCurveName)
+			, PauseTurnInPlaceCurveName(InSettings.PauseTurnInPlaceCurveName)
+			, LockTurnInPlaceCurveName(InSettings.LockTurnInPlaceCurveName)
+		{}
+
+		TObjectKey<UAnimSequence> Sequence;
+		FName TurnYawCurveName;
+		FName TurnWeightCurveName;
+		FName PauseTurnInPlaceCurveName;
+		FName LockTurnInPlaceCurveName;
+
+		bool operator==(const FKey& Other) const
+		{
+			return Sequence == Other.Sequence && TurnYawCurveName == Other.TurnYawCurveName &&
+				TurnWeightCurveName == Other.TurnWeightCurveName &&
+				PauseTurnInPlaceCurveName == Other.PauseTurnInPlaceCurveName &&
+				LockTurnInPlaceCurveName == Other.LockTurnInPlaceCurveName;
+		}
+
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			uint32 Hash = GetTypeHash(Key.Sequence);
+			Hash = HashCombine(Hash, GetTypeHash(Key.TurnYawCurveName));
+			Hash = HashCombine(Hash, GetTypeHash(Key.TurnWeightCurveName));
+			Hash = HashCombine(Hash, GetTypeHash(Key.PauseTurnInPlaceCurveName));
+			return HashCombine(Hash, GetTypeHash(Key.LockTurnInPlaceCurveName));
+		}
+	};
+
+	static FRWLock Lock;
+	static TMap<FKey, FTurnInPlaceCurveTablePtr> Tables;
+	static FDelegateHandle PostGarbageCollectHandle;
+}
+
+float FTurnInPlaceCurveTable::GetAppliedTurnYaw(float Time) const
+{
+	// The curve delta is applied from the first sample with any weight
+	if (FirstWeightedIndex == INDEX_NONE || FMath::Clamp(Time, 0.f, PlayLength) * SampleRate <= FirstWeightedIndex)
+	{
+		return 0.f;
+	}
+
+	const FTurnInPlaceCurveValues Current = Evaluate(Time);
+	return Current.RemainingTurnYaw * Current.TurnYawWeight - FirstWeightedTurnYaw;
+}
+
+bool FTurnInPlaceCurveTable::Matches(const UAnimSequence* InSequence, const FTurnInPlaceSettings& InSettings) const
+{
+	return Sequence == TObjectKey<UAnimSequence>(InSequence) &&
+		Settings.TurnYawCurveName == InSettings.TurnYawCurveName &&
+		Settings.TurnWeightCurveName == InSettings.TurnWeightCurveName &&
+		Settings.PauseTurnInPlaceCurveName == InSettings.PauseTurnInPlaceCurveName &&
+		Settings.LockTurnInPlaceCurveName == InSettings.LockTurnInPlaceCurveName;
+}
+
+FTurnInPlaceCurveTablePtr FTurnInPlaceCurveTableCache::FindOrBake(const UAnimSequence* Sequence, const FTurnInPlaceSettings& Settings)
+{
+	using namespace TurnInPlaceCurveTableCache;
+	
+	if (!Sequence)
+	{
+		return nullptr;
+	}
+
+	const FKey Key(Sequence, Settings);
+	{
+		FReadScopeLock ReadLock(Lock);
+		if (const FTurnInPlaceCurveTablePtr* Table = Tables.Find(Key))
+		{
+			return *Table;
+		}
+	}
+
+	// Bake outside the lock, if another thread baked the same table in the meantime we use theirs
+	FTurnInPlaceCurveTablePtr NewTable = Bake(Sequence, Settings);
+
+	FWriteScopeLock WriteLock(Lock);
+	if (!PostGarbageCollectHandle.IsValid())
+	{
+		PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&FTurnInPlaceCurveTableCache::PurgeStaleTables);
+	}
+	return Tables.FindOrAdd(Key, NewTable);
+}
+
+void FTurnInPlaceCurveTableCache::Prewarm(const FTurnInPlaceAnimSet& AnimSet, const FTurnInPlaceSettings& Settings)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FTurnInPlaceCurveTableCache::Prewarm);
+	
+	for (const UAnimSequence* Sequence : AnimSet.LeftTurns)
+	{
+		FindOrBake(Sequence, Settings);
+	}
+	for (const UAnimSequence* Sequence : AnimSet.RightTurns)
+	{
+		FindOrBake(Sequence, Settings);
+	}
+}
+
+void FTurnInPlaceCurveTableCache::PurgeStaleTables()
+{
+	using namespace TurnInPlaceCurveTableCache;
+
+	FWriteScopeLock WriteLock(Lock);
+	for (auto It = Tables.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().Sequence.ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FTurnInPlaceCurveTableCache::Shutdown()
+{
+	using namespace TurnInPlaceCurveTableCache;
+
+	FWriteScopeLock WriteLock(Lock);
+	if (PostGarbageCollectHandle.IsValid())
+	{
+		FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+		PostGarbageCollectHandle.Reset();
+	}
+	Tables.Empty();
+}
+
+FTurnInPlaceCurveTablePtr FTurnInPlaceCurveTableCache::Bake(const UAnimSequence* Sequence, const FTurnInPlaceSettings& Settings)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FTurnInPlaceCurveTableCache::Bake);
+
+	TSharedRef<FTurnInPlaceCurveTable, ESPMode::ThreadSafe> Table = MakeShared<FTurnInPlaceCurveTable, ESPMode::ThreadSafe>();
+	Table->Sequence = Sequence;
+	Table->Settings = Settings;
+	Table->PlayLength = Sequence->GetPlayLength();
+
+	// Place the final sample exactly at the end of the animation
+	const float BakeRate = FMath::Max(1.f, TurnInPlaceCurveTableCvars::CurveBakeRate);
+	const int32 NumSamples = FMath::Max(2, FMath::CeilToInt(Table->PlayLength * BakeRate) + 1);
+	Table->SampleRate = Table->PlayLength > 0.f ? (float)(NumSamples - 1) / Table->PlayLength : 0.f;
+
+	Table->Samples.Reserve(NumSamples);
+	for (int32 i = 0; i < NumSamples; i++)
+	{
+		const float Time = Table->PlayLength * ((float)i / (float)(NumSamples - 1));
+		Table->Samples.Emplace(
+			Sequence->EvaluateCurveData(Settings.TurnYawCurveName, Time),
+			Sequence->EvaluateCurveData(Settings.TurnWeightCurveName, Time),
+			Sequence->EvaluateCurveData(Settings.PauseTurnInPlaceCurveName, Time),
+			Sequence->EvaluateCurveData(Settings.LockTurnInPlaceCurveName, Time));
+	}
+
+	// Derive the constant rate that covers the same yaw in the same time, for procedural turns
+	Table->TotalTurnYaw = FMath::Abs(Table->Samples[0].RemainingTurnYaw);
+	Table->TurnDuration = Table->PlayLength;
+	for (int32 i = 1; i < NumSamples && Table->SampleRate > 0.f; i++)
+	{
+		if (FMath::IsNearlyZero(Table->Samples[i].RemainingTurnYaw, TurnInPlaceCurveTableCvars::TurnCompleteTolerance))
+		{
+			Table->TurnDuration = (float)i / Table->SampleRate;
+			break;
+		}
+	}
+	// Where GetAppliedTurnYaw() measures from
+	Table->FirstWeightedIndex = Table->Samples.IndexOfByPredicate([](const FTurnInPlaceCurveValues& Sample)
+	{
+		return !FMath::IsNearlyZero(Sample.TurnYawWeight, KINDA_SMALL_NUMBER);
+	});
+	if (Table->FirstWeightedIndex != INDEX_NONE)
+	{
+		const FTurnInPlaceCurveValues& First = Table->Samples[Table->FirstWeightedIndex];
+		Table->FirstWeightedTurnYaw = First.RemainingTurnYaw * First.TurnYawWeight;
+	}
+
+	const float RateScale = FMath::Abs(Sequence->RateScale);
+	Table->TurnRate = Table->TurnDuration > 0.f ? Table->TotalTurnYaw * RateScale / Table->TurnDuration : 0.f;
+
+	return Table;
+}
@@ -38,6 +38,12 @@ void UTurnInPlaceStatics::SetCharacterMovementType(ACharacter* Character, EChara
 			Character->GetCharacterMovement()->bUseControllerDesiredRotation = false;
 			break;
 		}
+
+		// The turn mode is derived from the movement settings, rebuild it if it was already evaluated this frame
+		if (UTurnInPlace* TurnInPlace = Character->FindComponentByClass<UTurnInPlace>())
+		{
+			TurnInPlace->InvalidateFrameContext();
+		}
 	}
 }
 
@@ -58,13 +64,14 @@ float UTurnInPlaceStatics::GetTurnInPlacePlayRate_ThreadSafe(const FTurnInPlaceA
 	}
 
 	// Rate changes, usually increases, when we're at the max angle to keep up with a player turning the camera (control rotation) quickly
-	const float MaxAngleRate = bHasReachedMaxAngle ? AnimGraphData.AnimSet.PlayRateAtMaxAngle : 1.f;
+	const FTurnInPlaceAnimSet& AnimSet = AnimGraphData.AnimSetHandle.GetAnimSet();
+	const float MaxAngleRate = bHasReachedMaxAngle ? AnimSet.PlayRateAtMaxAngle : 1.f;
 
 	// Detect a change in direction and apply a rate change, so that if we're currently turning left and the player
 	// wants to turn right, we speed up the turn rate so they can complete their old turn faster
 	const bool bWantsTurnRight = AnimGraphData.TurnOffset > 0.f;
 	const bool bDirectionChange = AnimGraphData.bIsTurning && bWantsTurnRight != AnimGraphData.bTurnRight;
-	const float DirectionChangeRate = bDirectionChange ? AnimGraphData.AnimSet.PlayRateOnDirectionChange : 1.f;
+	const float DirectionChangeRate = bDirectionChange ? AnimSet.PlayRateOnDirectionChange : 1.f;
 
 	// Rates below 1.0 are not supported with this logic
 	return FMath::Max(MaxAngleRate, DirectionChangeRate);
@@ -153,6 +160,22 @@ void UTurnInPlaceStatics::ThreadSafeUpdateTurnInPlace(const FTurnInPlaceAnimGrap
 	}
 }
 
+FTurnInPlaceAnimGraphInputs UTurnInPlaceStatics::GetAnimGraphInputs(const UTurnInPlace* TurnInPlace)
+{
+	return TurnInPlace ? TurnInPlace->GetAnimGraphInputs() : FTurnInPlaceAnimGraphInputs();
+}
+
+void UTurnInPlaceStatics::ThreadSafeUpdateTurnInPlaceFromInputs(const FTurnInPlaceAnimGraphInputs& Inputs,
+	FTurnInPlaceAnimGraphData& AnimGraphData, bool& bCanUpdateTurnInPlace, FTurnInPlaceAnimGraphOutput& Output)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlaceStatics::ThreadSafeUpdateTurnInPlaceFromInputs);
+
+	AnimGraphData = UTurnInPlace::BuildAnimGraphData(Inputs);
+	bCanUpdateTurnInPlace = Inputs.bHasValidData;
+	
+	ThreadSafeUpdateTurnInPlace_Internal(AnimGraphData, bCanUpdateTurnInPlace, Inputs.bIsStrafing, Output);
+}
+
 void UTurnInPlaceStatics::ThreadSafeUpdateTurnInPlace_Internal(const FTurnInPlaceAnimGraphData& AnimGraphData,
 	bool bCanUpdateTurnInPlace, bool bIsStrafing, FTurnInPlaceAnimGraphOutput& Output)
 {
@@ -186,24 +209,142 @@ FTurnInPlaceCurveValues UTurnInPlaceStatics::ThreadSafeUpdateTurnInPlaceCurveVal
 	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlaceStatics::ThreadSafeUpdateTurnInPlaceCurveValues);
 	
 	FTurnInPlaceCurveValues CurveValues;
+	const FTurnInPlaceSettings& Settings = AnimGraphData.AnimSetHandle.GetSettings();
 
 	// Turn anim graph curve values
-	CurveValues.RemainingTurnYaw = AnimInstance->GetCurveValue(AnimGraphData.Settings.TurnYawCurveName);
-	CurveValues.TurnYawWeight = AnimInstance->GetCurveValue(AnimGraphData.Settings.TurnWeightCurveName);
-	CurveValues.PauseTurnInPlace = AnimInstance->GetCurveValue(AnimGraphData.Settings.PauseTurnInPlaceCurveName);
-	CurveValues.LockTurnInPlace = AnimInstance->GetCurveValue(AnimGraphData.Settings.LockTurnInPlaceCurveName);
+	CurveValues.RemainingTurnYaw = AnimInstance->GetCurveValue(Settings.TurnYawCurveName);
+	CurveValues.TurnYawWeight = AnimInstance->GetCurveValue(Settings.TurnWeightCurveName);
+	CurveValues.PauseTurnInPlace = AnimInstance->GetCurveValue(Settings.PauseTurnInPlaceCurveName);
+	CurveValues.LockTurnInPlace = AnimInstance->GetCurveValue(Settings.LockTurnInPlaceCurveName);
 
 	return CurveValues;
 }
 
+void UTurnInPlaceStatics::ThreadSafePublishTurnInPlaceCurveValues(UTurnInPlace* TurnInPlace,
+	const FTurnInPlaceCurveValues& CurveValues)
+{
+	if (TurnInPlace)
+	{
+		TurnInPlace->PublishCurveValues(CurveValues);
+	}
+}
+
 void UTurnInPlaceStatics::ThreadSafeUpdateTurnInPlaceNode(FTurnInPlaceGraphNodeData& NodeData,
 	const FTurnInPlaceAnimGraphData& AnimGraphData, const FTurnInPlaceAnimSet& AnimSet)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlaceStatics::ThreadSafeUpdateTurnInPlaceNode);
+	// The anim set is already referenced by the anim graph data
+	ThreadSafeUpdateTurnInPlaceNodeFromHandle(NodeData, AnimGraphData);
+}
+
+void UTurnInPlaceStatics::ThreadSafeUpdateTurnInPlaceNodeFromHandle(FTurnInPlaceGraphNodeData& NodeData,
+	const FTurnInPlaceAnimGraphData& AnimGraphData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlaceStatics::ThreadSafeUpdateTurnInPlaceNodeFromHandle);
 	
 	// Retain play rate at max angle for this current turn, if we ever reached it
 	// This prevents micro jitters with mouse turning when it constantly re-enters max angle
 	bool bHasReachedMaxAngle;
 	NodeData.TurnPlayRate = GetTurnInPlacePlayRate_ThreadSafe(AnimGraphData, NodeData.bHasReachedMaxTurnAngle, bHasReachedMaxAngle);
-	NodeData.bHasReachedMaxTurnAngle = AnimSet.bMaintainMaxAnglePlayRate && bHasReachedMaxAngle;
+	NodeData.bHasReachedMaxTurnAngle = AnimGraphData.AnimSetHandle.GetAnimSet().bMaintainMaxAnglePlayRate && bHasReachedMaxAngle;
+}
+
+void UTurnInPlaceStatics::StepPseudoAnimState(float DeltaTime, const FTurnInPlaceAnimGraphData& AnimGraphData,
+	const FTurnInPlaceAnimGraphOutput& Output, ETurnPseudoAnimState& State, FTurnInPlaceGraphNodeData& NodeData,
+	TObjectPtr<UAnimSequence>& Anim)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlaceStatics::StepPseudoAnimState);
+	
+	const FTurnInPlaceAnimSet& AnimSet = AnimGraphData.AnimSetHandle.GetAnimSet();
+
+	switch (State)
+	{
+	case ETurnPseudoAnimState::Idle:
+		if (Output.bWantsToTurn)
+		{
+			State = ETurnPseudoAnimState::TurnInPlace;
+
+			// SetupTurnAnim()
+			NodeData.StepSize = AnimGraphData.StepSize;
+			NodeData.bIsTurningRight = AnimGraphData.bTurnRight;
+
+			// SetupTurnInPlace()
+			NodeData.AnimStateTime = AnimGraphData.TurnStartTime;
+			Anim = GetTurnInPlaceAnimation(AnimSet, NodeData, false);
+			NodeData.bHasReachedMaxTurnAngle = false;
+			ThreadSafeUpdateTurnInPlaceNodeFromHandle(NodeData, AnimGraphData);
+		}
+		break;
+	case ETurnPseudoAnimState::TurnInPlace:
+		if (Output.bAbortTurn)
+		{
+			State = ETurnPseudoAnimState::Idle;
+
+			// SetupIdle()
+			NodeData.TurnPlayRate = 1.f;
+			NodeData.bHasReachedMaxTurnAngle = false;
+		}
+		else if (Output.bWantsTurnRecovery)
+		{
+			State = ETurnPseudoAnimState::Recovery;
+
+			// SetupTurnRecovery() -- AnimStateTime is already carried over from TurnInPlace
+			NodeData.bIsRecoveryTurningRight = NodeData.bIsTurningRight;
+			Anim = GetTurnInPlaceAnimation(AnimSet, NodeData, true);
+		}
+		else
+		{
+			// UpdateTurnInPlace()
+			Anim = GetTurnInPlaceAnimation(AnimSet, NodeData, false);
+			NodeData.AnimStateTime = GetUpdatedTurnInPlaceAnimTime_ThreadSafe(Anim,
+				NodeData.AnimStateTime, DeltaTime, NodeData.TurnPlayRate);
+			ThreadSafeUpdateTurnInPlaceNodeFromHandle(NodeData, AnimGraphData);
+		}
+		break;
+	case ETurnPseudoAnimState::Recovery:
+		{
+			// UpdateTurnInPlaceRecovery()
+			Anim = GetTurnInPlaceAnimation(AnimSet, NodeData, true);
+			NodeData.AnimStateTime = GetUpdatedTurnInPlaceAnimTime_ThreadSafe(Anim,
+				NodeData.AnimStateTime, DeltaTime, 1.f);  // Recovery plays at 1x speed
+			if (!Anim || (Anim && NodeData.AnimStateTime >= Anim->GetPlayLength()))
+			{
+				State = ETurnPseudoAnimState::Idle;
+
+				// SetupIdle()
+				NodeData.TurnPlayRate = 1.f;
+				NodeData.bHasReachedMaxTurnAngle = false;
+			}
+		}
+		break;
+	}
+}
+
+void UTurnInPlaceStatics::ThreadSafeUpdatePseudoAnimState(float DeltaTime, const FTurnInPlaceAnimGraphData& AnimGraphData,
+	bool bIsStrafing, FTurnInPlaceAnimGraphOutput& Output, ETurnPseudoAnimState& State,
+	FTurnInPlaceGraphNodeData& NodeData, TObjectPtr<UAnimSequence>& Anim)
+{
+	Output = FTurnInPlaceAnimGraphOutput();
+	ThreadSafeUpdateTurnInPlace_Internal(AnimGraphData, true, bIsStrafing, Output);
+	StepPseudoAnimState(DeltaTime, AnimGraphData, Output, State, NodeData, Anim);
+}
+
+FTurnInPlaceAnimSet UTurnInPlaceStatics::GetAnimSetFromHandle(const FTurnInPlaceAnimSetHandle& Handle)
+{
+	return Handle.GetAnimSet();
+}
+
+FTurnInPlaceParams UTurnInPlaceStatics::GetParamsFromHandle(const FTurnInPlaceAnimSetHandle& Handle)
+{
+	return Handle.GetParams();
+}
+
+FTurnInPlaceSettings UTurnInPlaceStatics::GetSettingsFromHandle(const FTurnInPlaceAnimSetHandle& Handle)
+{
+	return Handle.GetSettings();
+}
+
+UAnimSequence* UTurnInPlaceStatics::GetTurnInPlaceAnimationFromHandle(const FTurnInPlaceAnimSetHandle& Handle,
+	const FTurnInPlaceGraphNodeData& NodeData, bool bRecovery)
+{
+	return GetTurnInPlaceAnimation(Handle.GetAnimSet(), NodeData, bRecovery);
 }
@@ -3,9 +3,50 @@
 
 #include "TurnInPlaceTags.h"
 
+#include "Misc/ScopeRWLock.h"
+
 namespace FTurnInPlaceTags
 {
 	UE_DEFINE_GAMEPLAY_TAG_COMMENT(TurnMode, "TurnMode", "Used to lookup turn angle settings");
 	UE_DEFINE_GAMEPLAY_TAG_COMMENT(TurnMode_Movement, "TurnMode.Movement", "Turn angle settings lookup to use when bOrientToMovement is true");
 	UE_DEFINE_GAMEPLAY_TAG_COMMENT(TurnMode_Strafe, "TurnMode.Strafe", "Turn angle settings lookup to use when bOrientToMovement is false");
+
+	namespace TurnModeRegistry
+	{
+		static FRWLock Lock;
+		static TMap<FGameplayTag, int32> Indices;
+	}
+
+	int32 RegisterTurnModeIndex(const FGameplayTag& TurnModeTag)
+	{
+		const int32 ExistingIndex = FindTurnModeIndex(TurnModeTag);
+		if (ExistingIndex != INDEX_NONE || !TurnModeTag.IsValid())
+		{
+			return ExistingIndex;
+		}
+
+		FWriteScopeLock WriteLock(TurnModeRegistry::Lock);
+		if (const int32* Index = TurnModeRegistry::Indices.Find(TurnModeTag))
+		{
+			return *Index;
+		}
+		return TurnModeRegistry::Indices.Add(TurnModeTag, TurnModeIndex_Strafe + 1 + TurnModeRegistry::Indices.Num());
+	}
+
+	int32 FindTurnModeIndex(const FGameplayTag& TurnModeTag)
+	{
+		// Native tags don't require a lookup
+		if (TurnModeTag == TurnMode_Movement)
+		{
+			return TurnModeIndex_Movement;
+		}
+		if (TurnModeTag == TurnMode_Strafe)
+		{
+			return TurnModeIndex_Strafe;
+		}
+
+		FReadScopeLock ReadLock(TurnModeRegistry::Lock);
+		const int32* Index = TurnModeRegistry::Indices.Find(TurnModeTag);
+		return Index ? *Index : INDEX_NONE;
+	}
 }
\ No newline at end of file
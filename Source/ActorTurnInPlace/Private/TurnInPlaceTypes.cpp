@@ -0,0 +1,381 @@
+﻿// Copyright (c) 2025 Jared Taylor
+
+
+#include "TurnInPlaceTypes.h"
+
+#include "GameFramework/Actor.h"
+#include "Engine/NetConnection.h"
+#include "Engine/PackageMapClient.h"
+#include <atomic>
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(TurnInPlaceTypes)
+
+DEFINE_LOG_CATEGORY(LogTurnInPlace);
+
+uint32 FTurnInPlaceSimulatedReplication::GetValueBits(ETurnNetPrecision Precision)
+{
+	switch (Precision)
+	{
+	case ETurnNetPrecision::Bits8: return 8;
+	case ETurnNetPrecision::Bits10: return 10;
+	case ETurnNetPrecision::Bits12: return 12;
+	default: return 16;
+	}
+}
+
+uint32 FTurnInPlaceSimulatedReplication::QuantizeAngle(float Angle, float Range, uint32 NumBits)
+{
+	const uint32 MaxQuantized = (1u << NumBits) - 1;
+	const float Alpha = (Angle + Range) / (2.f * Range);
+	return static_cast<uint32>(FMath::Clamp(FMath::RoundToInt(Alpha * MaxQuantized), 0, static_cast<int32>(MaxQuantized)));
+}
+
+float FTurnInPlaceSimulatedReplication::DequantizeAngle(uint32 Value, float Range, uint32 NumBits)
+{
+	const uint32 MaxQuantized = (1u << NumBits) - 1;
+	return (static_cast<float>(Value) / MaxQuantized) * 2.f * Range - Range;
+}
+
+ETurnNetPrecision FTurnInPlaceSimulatedReplication::GetPrecisionForConnection(UPackageMap* Map) const
+{
+	if (!NetPrecision.bReduceForDistantViewers || NetPrecision.DistantPrecision == NetPrecision.Precision || !Owner.IsValid())
+	{
+		return NetPrecision.Precision;
+	}
+
+	UPackageMapClient* MapClient = Cast<UPackageMapClient>(Map);
+	const UNetConnection* Connection = MapClient ? MapClient->GetConnection() : nullptr;
+	const AActor* ViewTarget = Connection ? Connection->ViewTarget.Get() : nullptr;
+	if (!ViewTarget)
+	{
+		return NetPrecision.Precision;
+	}
+
+	const float DistSq = FVector::DistSquared(ViewTarget->GetActorLocation(), Owner->GetActorLocation());
+	return DistSq > FMath::Square(NetPrecision.DistantViewerDistance) ? NetPrecision.DistantPrecision : NetPrecision.Precision;
+}
+
+bool FTurnInPlaceSimulatedReplication::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	bOutSuccess = true;
+
+	// Server time is only sent when simulated proxies extrapolate
+	uint8 bSerializeServerTime = bHasServerTime ? 1 : 0;
+	Ar.SerializeBits(&bSerializeServerTime, 1);
+	bHasServerTime = bSerializeServerTime != 0;
+	if (bHasServerTime)
+	{
+		Ar << ServerTime;
+	}
+
+	// Idle is by far the most common state, send it as a single bit
+	uint8 bIsZero = TurnOffset == 0 ? 1 : 0;
+	Ar.SerializeBits(&bIsZero, 1);
+	if (bIsZero)
+	{
+		TurnOffset = 0;
+		return true;
+	}
+
+	uint32 PrecisionCode = 0;
+	if (Ar.IsSaving())
+	{
+		PrecisionCode = static_cast<uint32>(ResolvePrecision(GetPrecisionForConnection(Map)));
+	}
+	Ar.SerializeInt(PrecisionCode, static_cast<uint32>(ETurnNetPrecision::Full) + 1);
+	const ETurnNetPrecision Precision = static_cast<ETurnNetPrecision>(PrecisionCode);
+
+	if (Precision == ETurnNetPrecision::Full)
+	{
+		Ar << TurnOffset;
+		return true;
+	}
+
+	uint32 RangeValue = RangeCode;
+	Ar.SerializeInt(RangeValue, RangeCodeMax + 1);
+	RangeCode = static_cast<uint8>(FMath::Min<uint32>(RangeValue, RangeCodeMax));
+
+	// Quantize over [-Range, Range]
+	const uint32 NumBits = GetValueBits(Precision);
+	uint32 Quantized = Ar.IsSaving() ? QuantizeAngle(Decompress(), GetRange(), NumBits) : 0;
+	Ar.SerializeInt(Quantized, 1u << NumBits);
+
+	if (Ar.IsLoading())
+	{
+		TurnOffset = FRotator::CompressAxisToShort(DequantizeAngle(Quantized, GetRange(), NumBits));
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
+namespace TurnInPlaceSnapshot
+{
+	static std::atomic<uint32> NextSnapshotId = { 1 };
+}
+
+FTurnInPlaceAnimSetSnapshot::FTurnInPlaceAnimSetSnapshot(const FTurnInPlaceAnimSet& InAnimSet, const FTurnInPlaceSettings& InSettings,
+	uint32 InVersion)
+	: AnimSet(InAnimSet)
+	, Settings(InSettings)
+	, Version(InVersion)
+	, SnapshotId(TurnInPlaceSnapshot::NextSnapshotId.fetch_add(1, std::memory_order_relaxed))
+	, StepSizeWarnings(EStepSizeWarning::None)
+	, bSortedStepSizes(false)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FTurnInPlaceAnimSetSnapshot::Build);
+
+	FMemory::Memzero(StepLookup);
+
+	const FTurnInPlaceParams& Params = AnimSet.Params;
+
+	// Resolve the turn angles into a flat array indexed by TurnMode, pointing into our own immutable AnimSet
+	for (const TPair<FGameplayTag, FTurnInPlaceAngles>& TurnAngles : Params.TurnAngles)
+	{
+		const int32 ModeIndex = FTurnInPlaceTags::RegisterTurnModeIndex(TurnAngles.Key);
+		if (ModeIndex != INDEX_NONE)
+		{
+			if (ModeIndex >= TurnAnglesByMode.Num())
+			{
+				TurnAnglesByMode.SetNumZeroed(ModeIndex + 1);
+			}
+			TurnAnglesByMode[ModeIndex] = &TurnAngles.Value;
+		}
+	}
+
+	// Hash the ignored montages
+	IgnoredMontages.Reserve(Params.MontageHandling.IgnoreMontages.Num());
+	for (const UAnimMontage* Montage : Params.MontageHandling.IgnoreMontages)
+	{
+		IgnoredMontages.Add(Montage);
+	}
+
+	const TArray<int32>& StepSizes = Params.StepSizes;
+
+	// Validate the step sizes, the TurnInPlace component reports these
+	if (StepSizes.Num() == 0)
+	{
+		StepSizeWarnings |= EStepSizeWarning::Empty;
+		return;
+	}
+
+	bool bSorted = true;
+	for (int32 i = 0; i < StepSizes.Num(); i++)
+	{
+		if (StepSizes[i] < 0 || StepSizes[i] > 180 || i > MAX_uint8)
+		{
+			StepSizeWarnings |= EStepSizeWarning::OutOfRange;
+		}
+		if (i > 0 && StepSizes[i] < StepSizes[i - 1])
+		{
+			bSorted = false;
+			StepSizeWarnings |= EStepSizeWarning::Unsorted;
+		}
+	}
+
+	bSortedStepSizes = bSorted;
+
+	// Each step size requires a corresponding animation
+	if (AnimSet.LeftTurns.Num() != StepSizes.Num())
+	{
+		StepSizeWarnings |= EStepSizeWarning::LeftTurnsCount;
+	}
+	if (AnimSet.RightTurns.Num() != StepSizes.Num())
+	{
+		StepSizeWarnings |= EStepSizeWarning::RightTurnsCount;
+	}
+
+	// Compile the lookup table, one entry per degree
+	// Greater compares the floored step angle, so sampling each whole degree is exact
+	// Nearest is sampled at each whole degree, ResolveNearestStepSize() handles the remainder of the degree
+	if (!bSorted)
+	{
+		// Unsorted step sizes are supported by searching every step size for each entry
+		for (int32 Index = 0; Index < StepLookupSize; Index++)
+		{
+			const float StepAngle = (float)(Index + StepLookupMinAngle);
+			StepLookup[Index] = (uint8)FMath::Min<int32>(SelectStepSize(Params, StepAngle), MAX_uint8);
+		}
+		return;
+	}
+
+	// Sorted step sizes can be compiled by sweeping the table once
+	int32 StepSize = 0;
+	for (int32 Index = 0; Index < StepLookupSize; Index++)
+	{
+		const float StepAngle = (float)(Index + StepLookupMinAngle);
+		switch (Params.SelectMode)
+		{
+		case ETurnAnimSelectMode::Nearest:
+			{
+				// Advance to the next distinct step size while it is strictly nearer, ties favour the earlier step size
+				int32 Next = StepSize + 1;
+				while (Next < StepSizes.Num() && StepSizes[Next] == StepSizes[StepSize])
+				{
+					Next++;
+				}
+				while (Next < StepSizes.Num() && FMath::Abs(StepAngle - (float)StepSizes[Next]) < FMath::Abs(StepAngle - (float)StepSizes[StepSize]))
+				{
+					StepSize = Next;
+					while (Next < StepSizes.Num() && StepSizes[Next] == StepSizes[StepSize])
+					{
+						Next++;
+					}
+				}
+			}
+			break;
+		case ETurnAnimSelectMode::Greater:
+			{
+				// The highest step size that the angle reaches
+				while (StepSize + 1 < StepSizes.Num() && FMath::FloorToInt(StepAngle) >= StepSizes[StepSize + 1])
+				{
+					StepSize++;
+				}
+			}
+			break;
+		default: ;
+		}
+		StepLookup[Index] = (uint8)FMath::Min<int32>(StepSize, MAX_uint8);
+	}
+}
+
+bool FTurnInPlaceAnimSetSnapshot::Matches(const FTurnInPlaceAnimSet& InAnimSet, const FTurnInPlaceSettings& InSettings) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FTurnInPlaceAnimSetSnapshot::Matches);
+	return Settings == InSettings && FTurnInPlaceAnimSet::StaticStruct()->CompareScriptStruct(&AnimSet, &InAnimSet, PPF_None);
+}
+
+int32 FTurnInPlaceAnimSetSnapshot::ResolveNearestStepSize(int32 StepSize, float StepAngle) const
+{
+	const FTurnInPlaceParams& Params = AnimSet.Params;
+	const TArray<int32>& StepSizes = Params.StepSizes;
+
+	// Unsorted step sizes can't be resolved from their neighbour
+	if (!bSortedStepSizes)
+	{
+		return SelectStepSize(Params, StepAngle);
+	}
+
+	if (!StepSizes.IsValidIndex(StepSize))
+	{
+		return StepSize;
+	}
+
+	// Integer step sizes are at least a degree apart, so only the next distinct step size can be nearer within this degree
+	int32 Next = StepSize + 1;
+	while (Next < StepSizes.Num() && StepSizes[Next] == StepSizes[StepSize])
+	{
+		Next++;
+	}
+
+	// Ties favour the earlier step size, the same as SelectStepSize()
+	if (Next < StepSizes.Num() && FMath::Abs(StepAngle - (float)StepSizes[Next]) < FMath::Abs(StepAngle - (float)StepSizes[StepSize]))
+	{
+		return Next;
+	}
+	return StepSize;
+}
+
+int32 FTurnInPlaceAnimSetSnapshot::SelectStepSize(const FTurnInPlaceParams& Params, float StepAngle)
+{
+	// Determine the step size based on the select mode
+	int32 StepSize = 0;
+	switch(Params.SelectMode)
+	{
+	case ETurnAnimSelectMode::Nearest:
+		{
+			// Find the animation nearest to the angle
+			float Diff = 0.f;
+			for (int32 i = 0; i < Params.StepSizes.Num(); i++)
+			{
+				const int32& TAngle = Params.StepSizes[i];
+				const float AngleDiff = FMath::Abs(StepAngle - (float)TAngle);
+				if (i == 0 || AngleDiff < Diff)
+				{
+					Diff = AngleDiff;
+					StepSize = i;
+				}
+			}
+		}
+		break;
+	case ETurnAnimSelectMode::Greater:
+		{
+			// Find the highest animation that exceeds the angle
+			for (int32 i = 0; i < Params.StepSizes.Num(); i++)
+			{
+				const int32& TAngle = Params.StepSizes[i];
+				if (FMath::FloorToInt(StepAngle) >= TAngle)
+				{
+					StepSize = i;
+				}
+			}
+		}
+		break;
+	default: ;
+	}
+
+	return StepSize;
+}
+
+const TSharedRef<const FTurnInPlaceAnimSetSnapshot, ESPMode::ThreadSafe>& FTurnInPlaceAnimSetSnapshot::GetDefault()
+{
+	static const TSharedRef<const FTurnInPlaceAnimSetSnapshot, ESPMode::ThreadSafe> Default =
+		MakeShared<const FTurnInPlaceAnimSetSnapshot, ESPMode::ThreadSafe>(FTurnInPlaceAnimSet(), FTurnInPlaceSettings(), 0);
+	return Default;
+}
+
+void FTurnInPlaceAnimSetHandle::AddStructReferencedObjects(FReferenceCollector& Collector) const
+{
+	if (Snapshot.IsValid())
+	{
+		Collector.AddPropertyReferences(FTurnInPlaceAnimSet::StaticStruct(), const_cast<FTurnInPlaceAnimSet*>(&Snapshot->AnimSet));
+	}
+}
+
+void FTurnInPlaceCurveChannel::Publish(const FTurnInPlaceCurveValues& Values)
+{
+	// Announce the publish first, a reader still copying this buffer from two publishes ago will see it and retry
+	const uint32 NextSequence = Sequence.load(std::memory_order_relaxed) + 1;
+	WriteSequence.store(NextSequence, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	FBuffer& Buffer = Buffers[NextSequence & 1];
+	Buffer.RemainingTurnYaw.store(Values.RemainingTurnYaw, std::memory_order_relaxed);
+	Buffer.TurnYawWeight.store(Values.TurnYawWeight, std::memory_order_relaxed);
+	Buffer.PauseTurnInPlace.store(Values.PauseTurnInPlace, std::memory_order_relaxed);
+	Buffer.LockTurnInPlace.store(Values.LockTurnInPlace, std::memory_order_relaxed);
+
+	Sequence.store(NextSequence, std::memory_order_release);
+}
+
+bool FTurnInPlaceCurveChannel::Read(FTurnInPlaceCurveValues& OutValues) const
+{
+	while (true)
+	{
+		const uint32 ReadSequence = Sequence.load(std::memory_order_acquire);
+		if (static_cast<int32>(ReadSequence - ResetSequence.load(std::memory_order_acquire)) <= 0)
+		{
+			return false;
+		}
+
+		const FBuffer& Buffer = Buffers[ReadSequence & 1];
+		OutValues.RemainingTurnYaw = Buffer.RemainingTurnYaw.load(std::memory_order_relaxed);
+		OutValues.TurnYawWeight = Buffer.TurnYawWeight.load(std::memory_order_relaxed);
+		OutValues.PauseTurnInPlace = Buffer.PauseTurnInPlace.load(std::memory_order_relaxed);
+		OutValues.LockTurnInPlace = Buffer.LockTurnInPlace.load(std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_acquire);
+
+		// Only a publish two ahead of the one we read writes the same buffer
+		if (WriteSequence.load(std::memory_order_relaxed) - ReadSequence < 2)
+		{
+			return true;
+		}
+	}
+}
+
+void FTurnInPlaceCurveChannel::Reset()
+{
+	// Only the writer may change its sequences, so discard everything up to the publish that may be in flight instead
+	// A single writer only ever has the publish after its last completed one in flight
+	ResetSequence.store(Sequence.load(std::memory_order_acquire) + 1, std::memory_order_release);
+}
@@ -0,0 +1,212 @@
+﻿// Copyright (c) 2025 Jared Taylor
+
+
+#include "TurnInPlaceWorldSubsystem.h"
+
+#include "TurnInPlace.h"
+#include "TurnInPlaceStatics.h"
+#include "System/TurnInPlaceStats.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(TurnInPlaceWorldSubsystem)
+
+namespace TurnInPlaceCvars
+{
+	static int32 PseudoBatchMinSize = 32;
+	FAutoConsoleVariableRef CVarPseudoBatchMinSize(
+		TEXT("p.Turn.Pseudo.BatchMinSize"),
+		PseudoBatchMinSize,
+		TEXT("Minimum number of characters processed by each task when batching pseudo anim state updates. Fewer characters than this are processed on the game thread"),
+		ECVF_Default);
+}
+
+void UTurnInPlaceWorldSubsystem::RegisterComponent(UTurnInPlace* TurnInPlace)
+{
+	if (!IsValid(TurnInPlace) || TurnInPlace->PseudoBatchIndex != INDEX_NONE)
+	{
+		return;
+	}
+
+	// Carry over the current pseudo state
+	TurnInPlace->PseudoBatchIndex = Components.Add(TurnInPlace);
+	States.Add(TurnInPlace->GetPseudoAnimState());
+	NodeData.Add(TurnInPlace->GetPseudoNodeData());
+	Anims.Add(TurnInPlace->GetPseudoAnim());
+	GraphInputs.AddDefaulted();
+	Outputs.AddDefaulted();
+	bShouldUpdate.Add(false);
+	StepDeltaTimes.Add(0.f);
+}
+
+void UTurnInPlaceWorldSubsystem::UnregisterComponent(UTurnInPlace* TurnInPlace)
+{
+	if (!TurnInPlace || !Components.IsValidIndex(TurnInPlace->PseudoBatchIndex) ||
+		Components[TurnInPlace->PseudoBatchIndex] != TurnInPlace)
+	{
+		return;
+	}
+
+	RemoveAtSwap(TurnInPlace->PseudoBatchIndex);
+	TurnInPlace->PseudoBatchIndex = INDEX_NONE;
+}
+
+void UTurnInPlaceWorldSubsystem::RemoveAtSwap(int32 Index)
+{
+	Components.RemoveAtSwap(Index);
+	States.RemoveAtSwap(Index);
+	NodeData.RemoveAtSwap(Index);
+	Anims.RemoveAtSwap(Index);
+	GraphInputs.RemoveAtSwap(Index);
+	Outputs.RemoveAtSwap(Index);
+	bShouldUpdate.RemoveAtSwap(Index);
+	StepDeltaTimes.RemoveAtSwap(Index);
+
+	// The last component was moved into the removed slot
+	if (Components.IsValidIndex(Index) && Components[Index])
+	{
+		Components[Index]->PseudoBatchIndex = Index;
+	}
+}
+
+void UTurnInPlaceWorldSubsystem::Tick(float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlaceWorldSubsystem::Tick);
+	
+	Super::Tick(DeltaTime);
+
+	// Remove any components that were destroyed without unregistering
+	for (int32 i = Components.Num() - 1; i >= 0; i--)
+	{
+		if (!IsValid(Components[i]))
+		{
+			RemoveAtSwap(i);
+		}
+	}
+
+	const int32 NumComponents = Components.Num();
+	if (NumComponents == 0)
+	{
+		return;
+	}
+
+	// Gather the anim graph inputs on the game thread, only the queries that need the component and its owner
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlaceWorldSubsystem::Gather);
+		for (int32 i = 0; i < NumComponents; i++)
+		{
+			UTurnInPlace* TurnInPlace = Components[i];
+			bShouldUpdate[i] = TurnInPlace->HasValidData() && TurnInPlace->WantsPseudoAnimState();
+			if (bShouldUpdate[i])
+			{
+				GraphInputs[i] = TurnInPlace->GatherAnimGraphInputs();
+				bool bResumed = false;
+				bShouldUpdate[i] = !GraphInputs[i].bProceduralTurn &&
+					TurnInPlace->ConsumePseudoAnimDeltaTime(GraphInputs[i].UpdateTier, DeltaTime, StepDeltaTimes[i], bResumed);
+
+				// The component reset its pseudo state after being frozen
+				if (bResumed)
+				{
+					States[i] = TurnInPlace->GetPseudoAnimState();
+					NodeData[i] = TurnInPlace->GetPseudoNodeData();
+					Anims[i] = TurnInPlace->GetPseudoAnim();
+				}
+			}
+		}
+	}
+
+	// Build the anim graph data and advance every pseudo state machine, this only touches our own arrays
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlaceWorldSubsystem::Advance);
+		const int32 MinBatchSize = FMath::Max(1, TurnInPlaceCvars::PseudoBatchMinSize);
+		ParallelFor(TEXT("TurnInPlacePseudoAnimState"), NumComponents, MinBatchSize, [this](int32 i)
+		{
+			if (bShouldUpdate[i])
+			{
+				// Strafing was captured on the game thread, the same as the unbatched update
+				const FTurnInPlaceAnimGraphData GraphData = UTurnInPlace::BuildAnimGraphData(GraphInputs[i]);
+				UTurnInPlaceStatics::ThreadSafeUpdatePseudoAnimState(StepDeltaTimes[i], GraphData, GraphInputs[i].bIsStrafing,
+					Outputs[i], States[i], NodeData[i], Anims[i]);
+			}
+		});
+	}
+
+	// Write the results back for the game thread to consume
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlaceWorldSubsystem::WriteBack);
+		for (int32 i = 0; i < NumComponents; i++)
+		{
+			if (bShouldUpdate[i])
+			{
+				Components[i]->ApplyBatchedPseudoAnimState(States[i], NodeData[i], Anims[i]);
+			}
+		}
+	}
+}
+
+const TArray<FVector>& UTurnInPlaceWorldSubsystem::GetViewLocations()
+{
+	if (ViewLocationsFrame == GFrameCounter)
+	{
+		return ViewLocations;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UTurnInPlaceWorldSubsystem::GetViewLocations);
+
+	ViewLocationsFrame = GFrameCounter;
+	ViewLocations.Reset();
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (const APlayerController* PlayerController = It->Get())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			ViewLocations.Add(ViewLocation);
+		}
+	}
+	return ViewLocations;
+}
+
+float UTurnInPlaceWorldSubsystem::GetDistSqToNearestView(const FVector& Location)
+{
+	float MinDistSq = MAX_flt;
+	for (const FVector& ViewLocation : GetViewLocations())
+	{
+		MinDistSq = FMath::Min(MinDistSq, static_cast<float>(FVector::DistSquared(Location, ViewLocation)));
+	}
+	return MinDistSq;
+}
+
+TStatId UTurnInPlaceWorldSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UTurnInPlaceWorldSubsystem, STATGROUP_TurnInPlace);
+}
+
+bool UTurnInPlaceWorldSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UTurnInPlaceWorldSubsystem::Deinitialize()
+{
+	for (UTurnInPlace* TurnInPlace : Components)
+	{
+		if (TurnInPlace)
+		{
+			TurnInPlace->PseudoBatchIndex = INDEX_NONE;
+		}
+	}
+	Components.Reset();
+	States.Reset();
+	NodeData.Reset();
+	Anims.Reset();
+	GraphInputs.Reset();
+	Outputs.Reset();
+	bShouldUpdate.Reset();
+	StepDeltaTimes.Reset();
+	ViewLocations.Reset();
+	
+	Super::Deinitialize();
+}
@@ -0,0 +1,89 @@
+﻿// Copyright (c) 2025 Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimNodeBase.h"
+#include "AlphaBlend.h"
+#include "TurnInPlaceTypes.h"
+#include "AnimNode_TurnInPlace.generated.h"
+
+class UAnimSequence;
+
+/**
+ * Native replacement for the turn in place state machine (Idle, TurnInPlace, Recovery and the AbortTurn alias)
+ * Selects the turn animation, applies the play rate, handles recovery and aborting, and evaluates the sequence itself
+ * Uses the same state logic as the dedicated server's pseudo anim state, @see UTurnInPlaceStatics::StepPseudoAnimState
+ * Source is output while idle, and blended with the turn animation when entering or leaving a turn
+ */
+USTRUCT(BlueprintInternalUseOnly)
+struct ACTORTURNINPLACE_API FAnimNode_TurnInPlace : public FAnimNode_Base
+{
+	GENERATED_BODY()
+
+	FAnimNode_TurnInPlace()
+		: bCanUpdateTurnInPlace(true)
+		, BlendTime(0.2f)
+		, BlendOption(EAlphaBlendOption::Linear)
+		, State(ETurnPseudoAnimState::Idle)
+	{}
+
+	/** Pose to output while not turning, typically the idle pose */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Links)
+	FPoseLink Source;
+
+	/** The anim graph data for this frame, usually bound to UTurnInPlaceAnimInstance::TurnAnimGraphData */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn, meta=(PinShownByDefault))
+	FTurnInPlaceAnimGraphData AnimGraphData;
+
+	/** False if turn in place could not be updated this frame, the current state is held until it can */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn, meta=(PinShownByDefault))
+	bool bCanUpdateTurnInPlace;
+
+	/** Time to blend between Source and the turn animation when a turn starts, completes or aborts */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn, meta=(PinHiddenByDefault, ClampMin="0", UIMin="0"))
+	float BlendTime;
+
+	/** Blend curve used when blending between Source and the turn animation */
+	UPROPERTY(EditAnywhere, Category=Turn)
+	EAlphaBlendOption BlendOption;
+
+protected:
+	/** Current state, matches the states of the Blueprint state machine */
+	UPROPERTY(Transient)
+	ETurnPseudoAnimState State;
+
+	/** Selection, play rate and time of the current turn */
+	UPROPERTY(Transient)
+	FTurnInPlaceGraphNodeData NodeData;
+
+	/** Output of the last update, including the transitions that drove the state */
+	UPROPERTY(Transient)
+	FTurnInPlaceAnimGraphOutput TurnOutput;
+
+	/** Turn or recovery animation currently being evaluated */
+	UPROPERTY(Transient)
+	TObjectPtr<UAnimSequence> Anim;
+
+	/** Weight of the turn animation over Source */
+	FAlphaBlend TurnBlend;
+
+public:
+	/** @return The current state */
+	ETurnPseudoAnimState GetState() const { return State; }
+
+	/** @return Output of the last update */
+	const FTurnInPlaceAnimGraphOutput& GetTurnOutput() const { return TurnOutput; }
+
+	// FAnimNode_Base interface
+	virtual void Initialize_AnyThread(const FAnimationInitializeContext& Context) override;
+	virtual void CacheBones_AnyThread(const FAnimationCacheBonesContext& Context) override;
+	virtual void Update_AnyThread(const FAnimationUpdateContext& Context) override;
+	virtual void Evaluate_AnyThread(FPoseContext& Output) override;
+	virtual void GatherDebugData(FNodeDebugData& DebugData) override;
+	// End of FAnimNode_Base interface
+
+protected:
+	/** Return to idle, the current turn animation blends out */
+	void ResetState();
+};
@@ -0,0 +1,114 @@
+﻿// Copyright (c) 2025 Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TurnInPlaceTypes.h"
+#include "TurnInPlaceAnimInterface.h"
+#include "Animation/AnimInstance.h"
+#include "TurnInPlaceAnimInstance.generated.h"
+
+class UTurnInPlace;
+
+/**
+ * This anim instance is optional. You can implement ITurnInPlaceAnimInterface in your own anim blueprint instead.
+ * 
+ * Implements ITurnInPlaceAnimInterface natively, which allows UTurnInPlace to query the anim set and curve values
+ * with a direct call instead of going through the blueprint VM
+ * If a blueprint subclass overrides either interface function, UTurnInPlace will call the blueprint implementation instead
+ *
+ * Turn in place is updated natively in NativeUpdateAnimation and NativeThreadSafeUpdateAnimation. Anim blueprints
+ * reparented to this class that already call UpdateTurnInPlace from their event graph must disable bNativeTurnInPlaceUpdate,
+ * otherwise turn in place is updated twice per frame
+ */
+UCLASS(Blueprintable)
+class ACTORTURNINPLACE_API UTurnInPlaceAnimInstance : public UAnimInstance, public ITurnInPlaceAnimInterface
+{
+	GENERATED_BODY()
+
+public:
+	/** Anim set to use for turn in place. Change it with SetTurnInPlaceAnimSet() at runtime */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Turn)
+	FTurnInPlaceAnimSet TurnInPlaceAnimSet;
+
+	/** Anim set asset to use when the TurnInPlace component's AnimSetSource is DataAsset */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn)
+	TObjectPtr<UTurnInPlaceAnimSetAsset> TurnInPlaceAnimSetAsset;
+
+	/**
+	 * If true, turn in place is updated natively and the results are available from TurnAnimGraphData and TurnAnimGraphOutput
+	 * Disable if the anim graph calls UpdateTurnInPlace and ThreadSafeUpdateTurnInPlace itself
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Turn)
+	bool bNativeTurnInPlaceUpdate = true;
+
+	/**
+	 * Build the anim graph data from the inputs captured by the TurnInPlace component during its movement update, so
+	 * turn in place is updated entirely in NativeThreadSafeUpdateAnimation
+	 * Falls back to NativeUpdateAnimation while the pseudo anim state needs updating and isn't batched
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Turn, meta=(EditCondition="bNativeTurnInPlaceUpdate"))
+	bool bThreadSafeTurnInPlaceUpdate = false;
+
+	/** False if blueprint overrides GetTurnInPlaceCurveValues, in which case the component must query it instead */
+	bool bPublishTurnCurveValues = true;
+
+	/** True if turn in place is updated from the captured inputs this frame, @see bThreadSafeTurnInPlaceUpdate */
+	bool bUpdateTurnInPlaceFromInputs = false;
+
+	/** Turn in place component on the owning actor */
+	UPROPERTY(Transient, BlueprintReadOnly, Category=Turn)
+	TObjectPtr<UTurnInPlace> TurnInPlace;
+
+	/** Game thread data for the anim graph, updated in NativeUpdateAnimation */
+	UPROPERTY(Transient, BlueprintReadOnly, Category=Turn)
+	FTurnInPlaceAnimGraphData TurnAnimGraphData;
+
+	/** Output for the anim graph, updated in NativeThreadSafeUpdateAnimation */
+	UPROPERTY(Transient, BlueprintReadOnly, Category=Turn)
+	FTurnInPlaceAnimGraphOutput TurnAnimGraphOutput;
+
+	/** Curve values cached in NativeThreadSafeUpdateAnimation, published to the TurnInPlace component for the game thread */
+	UPROPERTY(Transient, BlueprintReadOnly, Category=Turn)
+	FTurnInPlaceCurveValues TurnCurveValues;
+
+	/** False if turn in place could not be updated this frame */
+	UPROPERTY(Transient, BlueprintReadOnly, Category=Turn)
+	bool bCanUpdateTurnInPlace = false;
+
+	/** True if the character is strafing, updated in NativeUpdateAnimation */
+	UPROPERTY(Transient, BlueprintReadOnly, Category=Turn)
+	bool bIsStrafing = false;
+
+public:
+	/** Change the anim set and notify the turn in place component */
+	UFUNCTION(BlueprintCallable, Category=Turn)
+	void SetTurnInPlaceAnimSet(const FTurnInPlaceAnimSet& InAnimSet);
+
+	virtual FTurnInPlaceAnimSet GetTurnInPlaceAnimSet_Implementation() const override { return TurnInPlaceAnimSet; }
+	virtual FTurnInPlaceCurveValues GetTurnInPlaceCurveValues_Implementation() const override { return TurnCurveValues; }
+	virtual UTurnInPlaceAnimSetAsset* GetTurnInPlaceAnimSetAsset_Implementation() const override { return TurnInPlaceAnimSetAsset; }
+
+	/**
+	 * Direct access to the anim set without copying it, used by UTurnInPlace instead of GetTurnInPlaceAnimSet()
+	 * C++ subclasses should change TurnInPlaceAnimSet rather than override GetTurnInPlaceAnimSet_Implementation()
+	 */
+	const FTurnInPlaceAnimSet& GetTurnInPlaceAnimSetRef() const { return TurnInPlaceAnimSet; }
+
+	/** Direct access to the curve values cached by the anim graph */
+	const FTurnInPlaceCurveValues& GetTurnInPlaceCurveValuesRef() const { return TurnCurveValues; }
+
+	/**
+	 * @return True if a blueprint subclass overrides the interface functions, in which case they must be called via
+	 * ITurnInPlaceAnimInterface::Execute_* instead of directly
+	 */
+	static bool IsInterfaceImplementedInScript(const UClass* AnimClass);
+
+protected:
+	/** Determine if the character is strafing, called from NativeUpdateAnimation */
+	virtual bool IsStrafing() const;
+
+	virtual void NativeInitializeAnimation() override;
+	virtual void NativeUpdateAnimation(float DeltaSeconds) override;
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
+};
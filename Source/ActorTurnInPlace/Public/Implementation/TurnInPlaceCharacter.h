@@ -31,6 +31,29 @@ public:
 
 	/** Name of the TurnInPlace component. Use this name if you want to prevent creation of the component (with ObjectInitializer.DoNotCreateDefaultSubobject). */
 	static FName TurnInPlaceComponentName;
+
+	/**
+	 * Mesh anim tick option to use on a dedicated server when TurnInPlace doesn't require animation
+	 * @see UTurnInPlace::IsAnimationFree()
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Turn)
+	EVisibilityBasedAnimTickOption AnimationFreeServerAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+
+	/**
+	 * Replicate the turn offset as part of the character instead of replicating the TurnInPlace component
+	 * Saves the server the overhead of replicating an additional subobject for every character
+	 * UTurnInPlace::SimulatedReplicationMode TurnEvents requires the component to replicate and is not used
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Turn)
+	bool bReplicateTurnOffsetWithCharacter = false;
+
+protected:
+	/** Turn offset replicated to simulated proxies when bReplicateTurnOffsetWithCharacter is enabled */
+	UPROPERTY(ReplicatedUsing=OnRep_ReplicatedTurnOffset)
+	FTurnInPlaceSimulatedReplication ReplicatedTurnOffset;
+
+	UFUNCTION()
+	void OnRep_ReplicatedTurnOffset();
 	
 public:
 	ATurnInPlaceCharacter(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
@@ -54,5 +77,9 @@ public:
 	 */
 	virtual void FaceRotation(FRotator NewControlRotation, float DeltaTime = 0.f) override;
 
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void PostInitializeComponents() override;
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
+	virtual void BeginPlay() override;
 	virtual void Tick(float DeltaTime) override;
 };
@@ -74,6 +74,10 @@ public:
 	/** Handle rotation based on the TurnInPlace component */
 	virtual void PhysicsRotation(float DeltaTime) override;
 
+protected:
+	/** Apply any rotation deferred by UTurnInPlace::bDeferRotationToMovement within the same scoped movement update */
+	virtual void PerformMovement(float DeltaTime) override;
+
 public:
 	/** Get prediction data for a client game. Should not be used if not running as a client. Allocates the data on demand and can be overridden to allocate a custom override if desired. Result must be a FNetworkPredictionData_Client_Character. */
 	virtual class FNetworkPredictionData_Client* GetPredictionData_Client() const override;
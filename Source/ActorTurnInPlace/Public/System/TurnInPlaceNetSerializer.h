@@ -0,0 +1,22 @@
+﻿// Copyright (c) 2025 Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Iris/Serialization/NetSerializer.h"
+#include "TurnInPlaceNetSerializer.generated.h"
+
+/**
+ * Iris replication of FTurnInPlaceSimulatedReplication
+ * Iris serializes the state once for every connection, so FTurnInPlaceNetPrecision::Precision is always used
+ */
+USTRUCT()
+struct FTurnInPlaceSimulatedReplicationNetSerializerConfig : public FNetSerializerConfig
+{
+	GENERATED_BODY()
+};
+
+namespace UE::Net
+{
+	UE_NET_DECLARE_SERIALIZER(FTurnInPlaceSimulatedReplicationNetSerializer, ACTORTURNINPLACE_API);
+}
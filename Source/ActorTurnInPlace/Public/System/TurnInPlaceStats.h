@@ -0,0 +1,20 @@
+﻿// Copyright (c) 2025 Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("TurnInPlace"), STATGROUP_TurnInPlace, STATCAT_Advanced);
+
+/** Components that skipped TurnInPlace() this frame because nothing could change */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Sleeping Components"), STAT_TurnInPlaceSleeping, STATGROUP_TurnInPlace, ACTORTURNINPLACE_API);
+
+/** Components that evaluated TurnInPlace() this frame */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Awake Components"), STAT_TurnInPlaceAwake, STATGROUP_TurnInPlace, ACTORTURNINPLACE_API);
+
+/** Rotations applied with a sweep this frame, @see ERotationSweepHandling */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Swept Rotations"), STAT_TurnInPlaceSweptRotations, STATGROUP_TurnInPlace, ACTORTURNINPLACE_API);
+
+/** Rotations applied without a sweep this frame, @see ERotationSweepHandling */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Unswept Rotations"), STAT_TurnInPlaceUnsweptRotations, STATGROUP_TurnInPlace, ACTORTURNINPLACE_API);
@@ -4,7 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "TurnInPlaceTypes.h"
+#include "TurnInPlaceCurveTable.h"
 #include "Components/ActorComponent.h"
+#include "UObject/ObjectKey.h"
 #include "TurnInPlace.generated.h"
 
 #define TURN_ROTATOR_TOLERANCE	(1.e-3f)
@@ -12,6 +14,8 @@
 class ACharacter;
 class UCharacterMovementComponent;
 class UAnimInstance;
+class UTurnInPlaceAnimInstance;
+class UTurnInPlaceAnimSetAsset;
 struct FGameplayTag;
 /**
  * Core TurnInPlace functionality
@@ -40,6 +44,23 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn)
 	ETurnAnimUpdateMode DedicatedServerAnimUpdateMode = ETurnAnimUpdateMode::Animation;
 
+	/**
+	 * When using Pseudo anim update mode, let UTurnInPlaceWorldSubsystem advance the pseudo anim state of every
+	 * character together each frame, instead of relying on the anim instance calling UpdateTurnInPlace()
+	 * This allows the mesh to skip its anim update on the dedicated server
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn, meta=(EditCondition="DedicatedServerAnimUpdateMode==ETurnAnimUpdateMode::Pseudo", EditConditionHides))
+	bool bBatchPseudoAnimState = false;
+
+	/**
+	 * When using Pseudo anim update mode, sample curve tables baked from each turn animation instead of evaluating
+	 * the animation curves by name
+	 * Tables are shared between every component that uses the same animation
+	 * @see p.Turn.Pseudo.CurveBakeRate
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn, meta=(EditCondition="DedicatedServerAnimUpdateMode==ETurnAnimUpdateMode::Pseudo", EditConditionHides))
+	bool bBakePseudoAnimCurves = false;
+
 	/**
 	 * Allow simulated proxies to parse their animation curves to deduct turn offset
 	 * This prevents them being stuck in a turn while awaiting their next replication update if the server ticks at a
@@ -47,11 +68,76 @@ public:
 	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn)
 	bool bSimulateAnimationCurves = true;
+
+	/**
+	 * Reduce how often the server advances the pseudo anim state for characters far from every player
+	 * Skipped time is accumulated and applied in the next update
+	 * @see EvaluateUpdateTier()
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn)
+	FTurnInPlaceUpdateLOD ServerUpdateLOD;
+
+	/**
+	 * Reduce how often simulated proxies far from the local player simulate their animation curves
+	 * The curve delta since the last update is applied in the next update
+	 * @see EvaluateUpdateTier()
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn, meta=(EditCondition="bSimulateAnimationCurves"))
+	FTurnInPlaceUpdateLOD SimulatedProxyUpdateLOD;
 	
 	/** Turn in place settings */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Turn)
 	FTurnInPlaceSettings Settings;
 
+	/**
+	 * When to sweep the rotations applied by TurnInPlace() and FaceRotation()
+	 * Yaw-only rotation of a vertical capsule can't collide, so AutoDetect only sweeps when pitch or roll changes
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn)
+	ERotationSweepHandling RotationSweepHandling = ERotationSweepHandling::AutoDetect;
+
+	/**
+	 * Hold the rotation applied by FaceRotation() until the movement component's next PerformMovement(), so it is
+	 * applied in the same scoped movement update as the movement and attached components only update once
+	 * PhysicsRotation() is already called from within the movement component's scoped movement update
+	 *
+	 * Requires UTurnInPlaceMovement, or calling FlushPendingOwnerRotation() from your own PerformMovement() override
+	 * The owner's rotation doesn't reflect the turn until it is flushed
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn)
+	bool bDeferRotationToMovement = false;
+
+	/**
+	 * Where the anim set is retrieved from
+	 * Component allows a dedicated server using Pseudo mode to run without an anim instance, so the mesh doesn't
+	 * need to update its animation
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Turn)
+	ETurnAnimSetSource AnimSetSource = ETurnAnimSetSource::AnimInstance;
+
+	/** Anim set used when AnimSetSource is Component. Change it with SetComponentAnimSet() at runtime */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Turn, meta=(EditCondition="AnimSetSource==ETurnAnimSetSource::Component", EditConditionHides))
+	FTurnInPlaceAnimSet ComponentAnimSet;
+
+	/**
+	 * Anim set asset used when AnimSetSource is DataAsset. Change it with SetAnimSetAsset() at runtime
+	 * If not assigned, the anim instance is asked for one via ITurnInPlaceAnimInterface::GetTurnInPlaceAnimSetAsset()
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Turn, meta=(EditCondition="AnimSetSource==ETurnAnimSetSource::DataAsset", EditConditionHides))
+	TObjectPtr<UTurnInPlaceAnimSetAsset> AnimSetAsset;
+
+	/**
+	 * How often the anim set is retrieved from the anim instance
+	 * PerFrame compares the anim set against the snapshot every frame and only rebuilds the snapshot when it differs.
+	 * The anim set is read in place from UTurnInPlaceAnimInstance, but copied from blueprint implementations of
+	 * ITurnInPlaceAnimInterface
+	 * Versioned avoids the per-frame compare, but the anim graph must call NotifyAnimSetChanged() when the anim set changes
+	 * Component and DataAsset sources with an assigned asset are only ever rebuilt when changed, regardless of this setting
+	 * With a DataAsset source, this determines how often the anim instance is asked for its asset instead
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn)
+	ETurnAnimSetCacheMode AnimSetCacheMode = ETurnAnimSetCacheMode::PerFrame;
+
 	/** Owning character that we are turning in place */
 	UPROPERTY(Transient, DuplicateTransient, BlueprintReadOnly, Category=Turn)
 	TObjectPtr<APawn> PawnOwner;
@@ -64,10 +150,28 @@ public:
 	UPROPERTY(Transient, DuplicateTransient, BlueprintReadOnly, Category=Turn)
 	TObjectPtr<UAnimInstance> AnimInstance;
 
+	/**
+	 * AnimInstance when it derives from UTurnInPlaceAnimInstance and doesn't override the interface in blueprint
+	 * Allows querying the anim set and curve values directly instead of through ITurnInPlaceAnimInterface::Execute_*
+	 */
+	UPROPERTY(Transient, DuplicateTransient)
+	TObjectPtr<UTurnInPlaceAnimInstance> NativeAnimInstance;
+
+	/** Mesh resolved by GetMesh() when the binding was last refreshed, so we don't need to search for it every frame */
+	UPROPERTY(Transient, DuplicateTransient)
+	TObjectPtr<USkeletalMeshComponent> CachedMesh;
+
 	/** Cached checks when AnimInstance changes */
 	UPROPERTY()
 	bool bIsValidAnimInstance;
 
+	/**
+	 * Result of HasValidData(), updated when the owner, mesh or anim instance changes, and when the owner is destroyed
+	 * @see RefreshBinding()
+	 */
+	UPROPERTY(Transient)
+	bool bHasValidBinding;
+
 	/** If true, will warn if the owning character's AnimInstance does not implement ITurnInPlaceAnimInterface */
 	UPROPERTY(EditDefaultsOnly, Category=Turn)
 	bool bWarnIfAnimInterfaceNotImplemented;
@@ -85,19 +189,209 @@ protected:
 	UPROPERTY(ReplicatedUsing=OnRep_SimulatedTurnOffset)
 	FTurnInPlaceSimulatedReplication SimulatedTurnOffset;
 
+public:
+	/**
+	 * Precision of the turn offset replicated to simulated proxies, coarser for distant viewers
+	 * The turn offset is quantized over the active max turn angle
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn)
+	FTurnInPlaceNetPrecision SimulatedNetPrecision;
+
+	/**
+	 * What the server replicates to simulated proxies
+	 * TurnEvents stops replicating the turn offset while a turn plays, simulated proxies will simulate their animation
+	 * curves regardless of bSimulateAnimationCurves
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn)
+	ETurnReplicationMode SimulatedReplicationMode = ETurnReplicationMode::TurnOffset;
+
+	/** How simulated proxies predict the turn offset between replication updates */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn)
+	FTurnInPlaceProxyExtrapolation SimulatedProxyExtrapolation;
+
+protected:
+	/** Last turn transition, replicated to simulated proxies when using ETurnReplicationMode::TurnEvents */
+	UPROPERTY(ReplicatedUsing=OnRep_SimulatedTurnEvent)
+	FTurnInPlaceTurnEvent SimulatedTurnEvent;
+
+	/** Server only, true if the last replicated turn event was a start */
+	bool bReplicatedTurnStarted = false;
+
+	/**
+	 * Server only, the step and direction the anim graph selected for the current turn, latched when it started the turn
+	 * The turn offset keeps moving until the curves take over, so it can't be reselected when the turn event is sent
+	 */
+	int32 ReplicatedTurnStepSize = INDEX_NONE;
+	bool bReplicatedTurnRight = false;
+
+	/**
+	 * Simulated proxy only, the turn started by the last turn event until the anim graph starts playing it
+	 * The anim graph plays the step and direction the server selected, from the time the server has reached
+	 */
+	int32 TurnEventStepSize = INDEX_NONE;
+	bool bTurnEventTurnRight = false;
+	float TurnEventStartTime = 0.f;
+
+	/** Server only, the last turn offset replicated and when, @see FTurnInPlaceNetPrecision::Deadband */
+	float LastReplicatedTurnOffset = 0.f;
+	float LastReplicatedTurnOffsetTime = 0.f;
+
+	/** Simulated proxy only, predicts the turn offset between replication updates */
+	FTurnInPlaceOffsetExtrapolator OffsetExtrapolator;
+	/** Cached anim set, shared by pointer and only rebuilt when the anim set changes */
+	mutable FTurnInPlaceAnimSetSnapshotPtr AnimSetSnapshot;
+
+	/** Frame the AnimSetSnapshot was last built on, used by ETurnAnimSetCacheMode::PerFrame */
+	mutable uint64 AnimSetSnapshotFrame = 0;
+
+	/** Incremented each time the anim set is reported as changed */
+	uint32 AnimSetVersion = 0;
+
+	/**
+	 * AnimSetVersion when the anim set asset was last resolved, used when AnimSetSource is DataAsset
+	 * Resolving the asset may need to call into the anim instance and search the asset's snapshots under its lock
+	 */
+	mutable uint32 AnimSetAssetVersion = MAX_uint32;
+
+	/**
+	 * Final override resolved for each root motion montage, only valid while the montage handling it was resolved with
+	 * is unchanged
+	 */
+	mutable TMap<TObjectKey<UAnimMontage>, ETurnInPlaceOverride> MontageOverrideCache;
+
+	/** The snapshot that MontageOverrideCache was last validated against */
+	mutable uint32 MontageOverrideCacheSnapshotId = 0;
+
+	/** The montage handling that MontageOverrideCache was resolved with, compared when a different snapshot is used */
+	mutable FTurnInPlaceMontageHandling MontageOverrideCacheHandling;
+
+	/** False if the montage overrides must be resolved every time, @see CanCacheMontageOverrides() */
+	bool bCacheMontageOverrides = true;
+
+	/** Step size problems that have already been logged, so we don't log them every time the snapshot is rebuilt */
+	mutable FTurnInPlaceAnimSetSnapshot::EStepSizeWarning ReportedStepSizeWarnings = FTurnInPlaceAnimSetSnapshot::EStepSizeWarning::None;
+
+	/** Per-frame evaluation shared by every entry point, @see GetFrameContext() */
+	mutable FTurnInPlaceFrameContext FrameContext;
+
+	/** Number of times FrameContext has been built */
+	mutable uint32 FrameContextBuildCount = 0;
+
+	/** TurnMode tag that CachedTurnModeIndex was resolved for, @see ResolveTurnModeIndex() */
+	mutable FGameplayTag CachedTurnModeTag;
+
+	/** Dense index of CachedTurnModeTag, so the TurnMode registry is only queried when the tag changes */
+	mutable int32 CachedTurnModeIndex = INDEX_NONE;
+
+	/** Snapshot that CachedTurnModeIndex was resolved against, an unregistered tag can be registered by a newer snapshot */
+	mutable uint32 CachedTurnModeSnapshotId = 0;
+
+	/** Inputs to the last TurnInPlace() evaluation that changed nothing, used to skip evaluations while idle */
+	FTurnInPlaceQuiescence Quiescence;
+
+	/** True if the last TurnInPlace() evaluation was skipped because nothing could change */
+	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category=Turn)
+	bool bIsSleeping = false;
+
+	/** Baked curves for the current PseudoAnim, when using bBakePseudoAnimCurves */
+	mutable FTurnInPlaceCurveTablePtr PseudoCurveTable;
+
+	/** Snapshot that last had its turn animations baked, so we only prewarm when the anim set changes */
+	mutable uint32 PrewarmedSnapshotVersion = MAX_uint32;
+
+	/** Result of GetUpdateTier() for UpdateTierFrame */
+	mutable ETurnUpdateTier UpdateTier = ETurnUpdateTier::Full;
+
+	/** Frame UpdateTier was evaluated on */
+	mutable uint64 UpdateTierFrame = MAX_uint64;
+
+	/** Time skipped by SimulateTurnInPlace() due to SimulatedProxyUpdateLOD */
+	FTurnInPlaceUpdateThrottle SimulateThrottle;
+
+	/** Time skipped by the pseudo anim state due to ServerUpdateLOD */
+	FTurnInPlaceUpdateThrottle PseudoThrottle;
+
+	/** Rotation held by bDeferRotationToMovement until FlushPendingOwnerRotation() */
+	FRotator PendingOwnerRotation = FRotator::ZeroRotator;
+
+	/** Frame PendingOwnerRotation was set on */
+	uint64 PendingOwnerRotationFrame = 0;
+
+	/** True if PendingOwnerRotation hasn't been applied yet */
+	bool bHasPendingOwnerRotation = false;
+
+	/** True while FaceRotation() is processing, the only time the rotation can be deferred */
+	bool bCanDeferOwnerRotation = false;
+
+	/**
+	 * Curve values published by the anim graph from the anim worker thread, read by GetCurveValues() on the game thread
+	 * @see PublishCurveValues()
+	 */
+	FTurnInPlaceCurveChannel CurveChannel;
+
+	/**
+	 * Game thread data captured for the anim graph during the movement update, @see CaptureAnimGraphInputs()
+	 * Read by the anim graph's thread safe update
+	 */
+	UPROPERTY(Transient, VisibleInstanceOnly, Category=Turn)
+	FTurnInPlaceAnimGraphInputs AnimGraphInputs;
+
+	/** Turn in progress while turning procedurally, @see AdvanceProceduralTurn() */
+	FTurnInPlaceProceduralTurn ProceduralTurn;
+
+	/** True if we were turning procedurally when the procedural turn was last advanced */
+	bool bWasProceduralTurn = false;
+
+	/** Frame the procedural turn was last advanced on, it is only advanced once per frame */
+	uint64 ProceduralTurnFrame = MAX_uint64;
+
 public:
 	UTurnInPlace(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 	virtual void GetLifetimeReplicatedProps(TArray<class FLifetimeProperty>& OutLifetimeProps) const override;
 
+	/** Keep the objects referenced by the AnimSetSnapshot alive */
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
 	ENetRole GetLocalRole() const;
 	bool HasAuthority() const;
 
 	void CompressSimulatedTurnOffset(float LastTurnOffset);
 
+	/** @return True if the change since the turn offset was last replicated is worth replicating */
+	bool ShouldReplicateTurnOffset(float TurnOffset) const;
+
+	/** Extrapolate and correct the turn offset on simulated proxies, @see SimulatedProxyExtrapolation */
+	void ExtrapolateSimulatedTurnOffset(float DeltaTime);
+
+	/**
+	 * Replicate the start, recovery and abort of turns for ETurnReplicationMode::TurnEvents
+	 * @return True if a turn is playing, in which case the turn offset isn't replicated
+	 */
+	bool ReplicateTurnEvents();
+
+	/** Latch the step the anim graph or pseudo anim state selected for the turn, @see ReplicatedTurnStepSize */
+	void LatchReplicatedTurnStep(const FTurnInPlaceFrameContext& Context, bool bIsTurning);
+
 	UFUNCTION()
 	void OnRep_SimulatedTurnOffset();
 
+	UFUNCTION()
+	void OnRep_SimulatedTurnEvent();
+
+public:
+	/** @return The turn offset compressed for simulated proxies, for owners that replicate it themselves */
+	const FTurnInPlaceSimulatedReplication& GetSimulatedTurnOffset() const { return SimulatedTurnOffset; }
+
+	/** Apply a turn offset replicated by the owner instead of this component, e.g. ATurnInPlaceCharacter::bReplicateTurnOffsetWithCharacter */
+	void ReceiveSimulatedTurnOffset(const FTurnInPlaceSimulatedReplication& InSimulatedTurnOffset);
+
+	/** @return The last turn event received, only valid on simulated proxies using ETurnReplicationMode::TurnEvents */
+	UFUNCTION(BlueprintPure, Category=Turn)
+	FTurnInPlaceTurnEvent GetSimulatedTurnEvent() const { return SimulatedTurnEvent; }
+
+protected:
+
 	virtual void OnRegister() override;
 	virtual void InitializeComponent() override;
 
@@ -105,11 +399,48 @@ public:
 	void CacheUpdatedCharacter();
 	
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void DestroyComponent(bool bPromoteChildren = false) override;
 
 protected:
 	UFUNCTION()
 	virtual void OnAnimInstanceChanged();
+
+	UFUNCTION()
+	virtual void OnOwnerDestroyed(AActor* DestroyedActor);
+
+	/** Montages feed the override in the frame context, rebuild it when one starts */
+	UFUNCTION()
+	virtual void OnMontageStarted(UAnimMontage* Montage);
+
+	/** Montages feed the override in the frame context, rebuild it when one ends */
+	UFUNCTION()
+	virtual void OnMontageEnded(UAnimMontage* Montage, bool bInterrupted);
+
+	/** Bind or unbind the montage events on the current AnimInstance */
+	void BindMontageEvents(bool bBind);
+
+#if WITH_EDITOR
+	/** Resolve the asset's snapshot again if it was edited while playing */
+	void OnAnimSetAssetChanged(UTurnInPlaceAnimSetAsset* Asset);
+
+	FDelegateHandle AnimSetAssetChangedHandle;
+#endif
+
+	/** Re-evaluate bHasValidBinding, call when anything HasValidData() depends on has changed */
+	virtual void RefreshBinding();
+
+public:
+	/** The mesh resolved by GetMesh() when the binding was last refreshed */
+	USkeletalMeshComponent* GetCachedMesh() const { return CachedMesh; }
+
+	/**
+	 * Re-resolve the mesh from GetMesh() and move the AnimInstance binding over to it if it changed
+	 * Call after swapping the mesh that GetMesh() returns
+	 * @return True if the mesh changed
+	 */
+	UFUNCTION(BlueprintCallable, Category=Turn)
+	bool RefreshCachedMesh();
 	
 public:
 	/**
@@ -119,6 +450,35 @@ public:
 	UFUNCTION(BlueprintPure, Category=Turn)
 	bool IsTurningInPlace() const;
 
+	/** @return True if the last evaluation was skipped because the character is idle and nothing could change */
+	UFUNCTION(BlueprintPure, Category=Turn)
+	bool IsTurnInPlaceSleeping() const { return bIsSleeping; }
+
+	/**
+	 * How often we are updated, evaluated the first time it is requested each frame
+	 * Always Full unless the update LOD for our net role is enabled
+	 */
+	UFUNCTION(BlueprintPure, Category=Turn)
+	ETurnUpdateTier GetUpdateTier() const;
+
+	/** @return ServerUpdateLOD or SimulatedProxyUpdateLOD based on our net role, nullptr for autonomous proxies */
+	const FTurnInPlaceUpdateLOD* GetUpdateLOD() const;
+
+	/**
+	 * Determine how often we should be updated when the update LOD for our net role is enabled
+	 * Defaults to the distance from the nearest player's view, override to use your own metric e.g. the Significance Manager
+	 * @param LOD The update LOD for our net role
+	 */
+	UFUNCTION(BlueprintNativeEvent, Category=Turn)
+	ETurnUpdateTier EvaluateUpdateTier(const FTurnInPlaceUpdateLOD& LOD) const;
+
+	/**
+	 * @return True if turning procedurally instead of reading animation curves
+	 * @see FTurnInPlaceUpdateLOD::bProceduralTurnWhenReduced
+	 */
+	UFUNCTION(BlueprintPure, Category=Turn)
+	bool IsProceduralTurn() const;
+
 	/** @return True if the character is currently moving */
 	UFUNCTION(BlueprintPure, Category=Turn)
 	bool IsCharacterMoving() const { return !IsCharacterStationary(); }
@@ -145,14 +505,48 @@ public:
 	
 	/**
 	 * Optionally override determine when to ignore root motion montages
+	 * The result is cached per montage unless this is overridden in blueprint, C++ overrides that depend on other state
+	 * must override CanCacheMontageOverrides() or call InvalidateMontageOverrideCache() when their result changes
 	 * @param Montage The montage to check
 	 * @return True if the montage should be ignored
 	 */
 	UFUNCTION(BlueprintNativeEvent, Category=Turn)
 	bool ShouldIgnoreRootMotionMontage(const UAnimMontage* Montage) const;
 
+	/**
+	 * Optionally override turn in place for specific montages
+	 * The result is cached per montage unless this is overridden in blueprint, C++ overrides that depend on other state
+	 * must override CanCacheMontageOverrides() or call InvalidateMontageOverrideCache() when their result changes
+	 * @param Montage The montage to check
+	 * @return The override to use for this montage, Default if it has none
+	 */
 	UFUNCTION(BlueprintNativeEvent, Category=Turn)
 	ETurnInPlaceOverride GetOverrideForMontage(const UAnimMontage* Montage) const;
+
+	/**
+	 * Resolve the final override for a root motion montage from GetOverrideForMontage() and ShouldIgnoreRootMotionMontage()
+	 * The result is cached per montage until the anim set's montage handling changes or InvalidateMontageOverrideCache() is called,
+	 * unless CanCacheMontageOverrides() returned false
+	 * @param Montage The root motion montage that is playing
+	 * @return The override to use while this montage is playing
+	 */
+	ETurnInPlaceOverride ResolveMontageOverride(const UAnimMontage* Montage) const;
+
+	/**
+	 * Checked on BeginPlay
+	 * @return False if GetOverrideForMontage() or ShouldIgnoreRootMotionMontage() can return different results for the
+	 * same montage and montage handling, in which case they are called every time instead of being cached
+	 * By default, caching is disabled if either is overridden in blueprint
+	 */
+	virtual bool CanCacheMontageOverrides() const;
+
+	/**
+	 * Call if the montage handling changes without the anim set changing
+	 * e.g. GetOverrideForMontage() or ShouldIgnoreRootMotionMontage() are overridden and their result changed
+	 * Also invalidates the frame context so the new override applies this frame
+	 */
+	UFUNCTION(BlueprintCallable, Category=Turn)
+	void InvalidateMontageOverrideCache();
 	
 	/**
 	 * This function is primarily used for debugging, if the controller doesn't exist debugging won't work
@@ -163,6 +557,7 @@ public:
 	
 	/**
 	 * Get the character's mesh component that is used for turn in place
+	 * Only called when the owner is cached, use GetCachedMesh() to retrieve the result
 	 * @return The character's mesh
 	 */
 	UFUNCTION(BlueprintNativeEvent, Category=Turn)
@@ -238,11 +633,88 @@ public:
 	/** Get the current turn in place state that determines if turn in place is enabled, paused, or locked */
 	ETurnInPlaceEnabledState GetEnabledState(const FTurnInPlaceParams& Params) const;
 
-	/** Retrieve the turn in place anim set */
+	/** Retrieve the turn in place anim set from the anim instance. Prefer GetAnimSetSnapshot() which doesn't copy */
 	FTurnInPlaceAnimSet GetTurnInPlaceAnimSet() const;
+
+	/**
+	 * @return The anim set without copying it, or nullptr if it can only be retrieved by value, i.e. from a blueprint
+	 * implementation of ITurnInPlaceAnimInterface
+	 */
+	const FTurnInPlaceAnimSet* GetTurnInPlaceAnimSetDirect() const;
+
+	/**
+	 * Get the cached turn in place anim set, rebuilding it if the anim set has changed
+	 * Hold onto the returned pointer to guarantee the anim set remains valid for the duration of your scope
+	 */
+	FTurnInPlaceAnimSetSnapshotPtr GetAnimSetSnapshot() const;
+
+	/** Change the anim set used when AnimSetSource is Component */
+	UFUNCTION(BlueprintCallable, Category=Turn)
+	void SetComponentAnimSet(const FTurnInPlaceAnimSet& InAnimSet);
+
+	/** Change the anim set asset used when AnimSetSource is DataAsset */
+	UFUNCTION(BlueprintCallable, Category=Turn)
+	void SetAnimSetAsset(UTurnInPlaceAnimSetAsset* InAnimSetAsset);
+
+	/** @return The anim set asset assigned to us, or the anim instance's if we don't have one */
+	UFUNCTION(BlueprintPure, Category=Turn)
+	UTurnInPlaceAnimSetAsset* GetAnimSetAsset() const;
+
+	/**
+	 * @return True if we can update without an anim instance
+	 * Requires Pseudo mode on a dedicated server, with an anim set that doesn't come from the anim instance
+	 */
+	UFUNCTION(BlueprintPure, Category=Turn)
+	bool IsAnimationFree() const;
+
+	/**
+	 * Call when the anim set returned by ITurnInPlaceAnimInterface::GetTurnInPlaceAnimSet() changes
+	 * Required when using ETurnAnimSetCacheMode::Versioned, otherwise the previous anim set remains in use
+	 */
+	UFUNCTION(BlueprintCallable, Category=Turn)
+	void NotifyAnimSetChanged();
+
+	/**
+	 * Get the evaluation for the current frame, building it the first time it is requested each frame
+	 * The anim set, curve values, enabled state and turn mode are only queried from the anim instance once per frame
+	 */
+	const FTurnInPlaceFrameContext& GetFrameContext() const;
+
+	/**
+	 * Force the frame context to be rebuilt the next time it is requested, e.g. after changing state mid-frame
+	 * Called for you when the anim set, montages, montage overrides or SetCharacterMovementType() change
+	 * Call it yourself if an override of GetTurnModeTag() or OverrideTurnInPlace() changes its result mid-frame
+	 */
+	UFUNCTION(BlueprintCallable, Category=Turn)
+	void InvalidateFrameContext();
+
+	/** Number of times the frame context has been built, for verifying it is only built once per frame */
+	uint32 GetFrameContextBuildCount() const { return FrameContextBuildCount; }
+
+protected:
+	/**
+	 * Consume the turn offset at the rate of the turn animation that the anim graph would select, without sampling it
+	 * Called from TurnInPlace(), only advances once per frame regardless of how many times that is called
+	 * Also discards the curve delta when switching between procedural and animated turns
+	 */
+	void AdvanceProceduralTurn(float DeltaTime);
+
+	/** @return The dense index for TurnModeTag, only queried from the TurnMode registry when the tag or snapshot changes */
+	int32 ResolveTurnModeIndex(const FGameplayTag& TurnModeTag, const FTurnInPlaceAnimSetSnapshot& Snapshot) const;
+
+	/** Called when AnimSetSnapshot is replaced */
+	void OnAnimSetSnapshotChanged(bool bPrewarmCurves) const;
+
+	/** Log any problems found with the step sizes when the snapshot was built */
+	virtual void ReportStepSizeWarnings(const FTurnInPlaceAnimSetSnapshot& Snapshot) const;
+
+public:
 	
-	/** Get the current turn in place parameters */
-	FTurnInPlaceParams GetParams() const;
+	/**
+	 * Get the current turn in place parameters
+	 * @warning Only valid until the anim set changes, use GetAnimSetSnapshot() if you need to retain them
+	 */
+	const FTurnInPlaceParams& GetParams() const;
 
 	/** Get the current turn in place curve values that were cached by the animation graph */
 	FTurnInPlaceCurveValues GetCurveValues() const;
@@ -250,8 +722,11 @@ public:
 	/** Dedicated server updates the turn in place curve values manually */
 	virtual bool WantsPseudoAnimState() const;
 	
-	/** @return True if the TurnInPlace component has valid data */
-	virtual bool HasValidData() const;
+	/**
+	 * @return True if the TurnInPlace component has valid data
+	 * This is cached, override RefreshBinding() instead to add your own conditions
+	 */
+	bool HasValidData() const { return bHasValidBinding; }
 
 	/** Which method to use for turning in place. Either PhysicsRotation() or FaceRotation() */
 	virtual ETurnMethod GetTurnMethod() const;
@@ -271,6 +746,37 @@ public:
 
 	/** Must be called from your ACharacter::FaceRotation() and UCharacterMovementComponent::PhysicsRotation() overrides */
 	virtual void PostTurnInPlace(float LastTurnOffset);
+
+	/**
+	 * Rotate the owner, sweeping based on RotationSweepHandling
+	 * Held until FlushPendingOwnerRotation() when deferred by bDeferRotationToMovement
+	 * @return True if the rotation was applied or deferred
+	 */
+	bool SetOwnerRotation(const FRotator& NewRotation);
+
+	/** @return The owner's rotation, including any rotation that has been deferred */
+	FRotator GetOwnerRotation() const;
+
+	/** @return True if a rotation is held by bDeferRotationToMovement */
+	bool HasPendingOwnerRotation() const { return bHasPendingOwnerRotation; }
+
+	/**
+	 * Apply the rotation held by bDeferRotationToMovement
+	 * Call from within the movement component's scoped movement update so it is applied together with the movement
+	 */
+	void FlushPendingOwnerRotation();
+
+	/** Discard the rotation held by bDeferRotationToMovement, e.g. when the owner's rotation has been reset */
+	void ClearPendingOwnerRotation() { bHasPendingOwnerRotation = false; }
+
+protected:
+	/** Rotate the owner immediately, sweeping based on RotationSweepHandling */
+	bool ApplyOwnerRotation(const FRotator& NewRotation) const;
+
+public:
+
+	/** @return True if rotating the owner from CurrentRotation to NewRotation should sweep, based on RotationSweepHandling */
+	bool ShouldSweepRotation(const FRotator& CurrentRotation, const FRotator& NewRotation) const;
 	
 	/**
 	 * Must be called from your ACharacter::FaceRotation() override
@@ -295,6 +801,38 @@ public:
 	UFUNCTION(BlueprintCallable, Category=Turn)
 	FTurnInPlaceAnimGraphData UpdateAnimGraphData(float DeltaTime) const;
 
+	/** Gather everything the anim graph needs from the game thread for the current frame */
+	FTurnInPlaceAnimGraphInputs GatherAnimGraphInputs() const;
+
+	/**
+	 * Capture the anim graph inputs for the current frame, so the anim graph doesn't need to call UpdateAnimGraphData()
+	 * on the game thread. Called by PostTurnInPlace() and SimulateTurnInPlace()
+	 */
+	void CaptureAnimGraphInputs();
+
+	/**
+	 * Capture the anim graph inputs unless they were already captured this frame
+	 * The movement update doesn't always reach PostTurnInPlace(), e.g. without a controller, or on the server between
+	 * ServerMoves. Call from the game thread animation update before the anim graph reads GetAnimGraphInputs()
+	 */
+	UFUNCTION(BlueprintCallable, Category=Turn)
+	void CaptureAnimGraphInputsIfStale();
+
+	/**
+	 * Publish the curve values sampled by the anim graph, GetCurveValues() will prefer these over querying the anim instance
+	 * Thread safe, call from the anim graph's thread safe update only
+	 */
+	void PublishCurveValues(const FTurnInPlaceCurveValues& CurveValues) { CurveChannel.Publish(CurveValues); }
+
+	/** The anim graph inputs captured by CaptureAnimGraphInputs() */
+	const FTurnInPlaceAnimGraphInputs& GetAnimGraphInputs() const { return AnimGraphInputs; }
+
+	/**
+	 * Build the anim graph data from inputs gathered on the game thread
+	 * Thread safe, only touches the inputs passed in
+	 */
+	static FTurnInPlaceAnimGraphData BuildAnimGraphData(const FTurnInPlaceAnimGraphInputs& Inputs);
+
 	/** Called immediately after UpdateAnimGraphData() for post-processing */
 	UFUNCTION(BlueprintCallable, Category=Turn)
 	void PostUpdateAnimGraphData(float DeltaTime, FTurnInPlaceAnimGraphData& AnimGraphData, FTurnInPlaceAnimGraphOutput& TurnOutput);
@@ -306,8 +844,33 @@ public:
 	virtual void UpdatePseudoAnimState(float DeltaTime, const FTurnInPlaceAnimGraphData& TurnAnimData,
 		FTurnInPlaceAnimGraphOutput& TurnOutput);
 
+	/**
+	 * Accumulate DeltaTime for the pseudo anim state based on the update tier
+	 * Coming out of Frozen, the pseudo anim state is reset to Idle and the stale curve delta is discarded
+	 * @param OutDeltaTime The time to advance the pseudo anim state by, including any skipped time
+	 * @param bOutResumed True if the pseudo anim state was reset after being frozen
+	 * @return True if the pseudo anim state should be advanced this frame
+	 */
+	bool ConsumePseudoAnimDeltaTime(ETurnUpdateTier Tier, float DeltaTime, float& OutDeltaTime, bool& bOutResumed);
+
+	/** Receive the pseudo anim state advanced by UTurnInPlaceWorldSubsystem */
+	void ApplyBatchedPseudoAnimState(ETurnPseudoAnimState InState, const FTurnInPlaceGraphNodeData& InNodeData, UAnimSequence* InAnim);
+
+	ETurnPseudoAnimState GetPseudoAnimState() const { return PseudoAnimState; }
+	const FTurnInPlaceGraphNodeData& GetPseudoNodeData() const { return PseudoNodeData; }
+	UAnimSequence* GetPseudoAnim() const { return PseudoAnim; }
+
+	/** @return True if UTurnInPlaceWorldSubsystem is advancing our pseudo anim state */
+	bool IsPseudoAnimStateBatched() const { return PseudoBatchIndex != INDEX_NONE; }
+
+	/** Index into UTurnInPlaceWorldSubsystem's pseudo anim state, INDEX_NONE if not registered. Maintained by the subsystem */
+	int32 PseudoBatchIndex = INDEX_NONE;
+
 protected:
-	/** Used to determine which step size to use based on the current TurnOffset and the last FTurnInPlaceParams */
+	/** Used to determine which step size to use based on the current TurnOffset, using the snapshot's precompiled lookup table */
+	static int32 DetermineStepSize(const FTurnInPlaceAnimSetSnapshot& Snapshot, float Angle, bool& bTurnRight);
+
+	/** Used to determine which step size to use based on the current TurnOffset by searching FTurnInPlaceParams::StepSizes */
 	static int32 DetermineStepSize(const FTurnInPlaceParams& Params, float Angle, bool& bTurnRight);
 
 public:
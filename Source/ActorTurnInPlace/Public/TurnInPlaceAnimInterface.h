@@ -7,6 +7,8 @@
 #include "UObject/Interface.h"
 #include "TurnInPlaceAnimInterface.generated.h"
 
+class UTurnInPlaceAnimSetAsset;
+
 UINTERFACE()
 class UTurnInPlaceAnimInterface : public UInterface
 {
@@ -29,6 +31,15 @@ public:
 	FTurnInPlaceAnimSet GetTurnInPlaceAnimSet() const;
 	virtual FTurnInPlaceAnimSet GetTurnInPlaceAnimSet_Implementation() const { return {}; }
 
+	/**
+	 * Get the current turn in place anim set asset, used when the TurnInPlace component's AnimSetSource is DataAsset
+	 * and the component doesn't have an asset assigned
+	 * You must maintain thread safety when implementing this function.
+	 */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category=Turn, meta=(BlueprintThreadSafe))
+	UTurnInPlaceAnimSetAsset* GetTurnInPlaceAnimSetAsset() const;
+	virtual UTurnInPlaceAnimSetAsset* GetTurnInPlaceAnimSetAsset_Implementation() const { return nullptr; }
+
 	/**
 	 * Get the cached turn in place curve values.
 	 * These should have been cached in NativeThreadSafeUpdateAnimation or BlueprintThreadSafeUpdateAnimation
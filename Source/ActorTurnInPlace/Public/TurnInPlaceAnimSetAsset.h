@@ -0,0 +1,57 @@
+﻿// Copyright (c) 2025 Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TurnInPlaceTypes.h"
+#include "Engine/DataAsset.h"
+#include "TurnInPlaceAnimSetAsset.generated.h"
+
+#if WITH_EDITOR
+class UTurnInPlaceAnimSetAsset;
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnTurnInPlaceAnimSetAssetChanged, UTurnInPlaceAnimSetAsset* /* Asset */);
+#endif
+
+/**
+ * Turn in place anim set that is shared by reference instead of being copied into every anim instance
+ * The runtime snapshot (step size lookup, turn angles by mode, ignored montages) is built once when loaded and shared
+ * by every TurnInPlace component that uses this asset, so switching anim sets is a pointer swap
+ */
+UCLASS(BlueprintType)
+class ACTORTURNINPLACE_API UTurnInPlaceAnimSetAsset : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** The turn anims to play and turn params */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Turn)
+	FTurnInPlaceAnimSet AnimSet;
+
+protected:
+	/** Snapshots built from AnimSet, one for each unique set of curve names. Almost always only one */
+	TArray<FTurnInPlaceAnimSetSnapshotPtr, TInlineAllocator<1>> Snapshots;
+
+	/** Guards Snapshots, which can be built on first request */
+	FRWLock SnapshotLock;
+
+public:
+	/**
+	 * Get the snapshot of this anim set for the curve names used by a TurnInPlace component
+	 * @param Settings The TurnInPlace component's settings
+	 * @return The shared snapshot, built on first request if these settings haven't been seen before
+	 */
+	FTurnInPlaceAnimSetSnapshotPtr GetSnapshot(const FTurnInPlaceSettings& Settings);
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	/** Broadcast when an asset is edited, so TurnInPlace components that cache its snapshot can resolve it again */
+	static FOnTurnInPlaceAnimSetAssetChanged OnAnimSetAssetChanged;
+
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+protected:
+	/** Rebuild the snapshots for every set of curve names requested so far, or the default settings if none were */
+	void RebuildSnapshots();
+};
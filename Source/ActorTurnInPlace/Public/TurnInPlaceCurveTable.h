@@ -0,0 +1,125 @@
+﻿// Copyright (c) 2025 Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TurnInPlaceTypes.h"
+#include "UObject/ObjectKey.h"
+
+class UAnimSequence;
+
+/**
+ * Turn in place curve values baked from a turn animation at a uniform sample rate
+ * Pseudo anim evaluation samples this table instead of resolving and evaluating each curve by name
+ */
+struct ACTORTURNINPLACE_API FTurnInPlaceCurveTable
+{
+	FTurnInPlaceCurveTable()
+		: SampleRate(0.f)
+		, PlayLength(0.f)
+		, TotalTurnYaw(0.f)
+		, TurnDuration(0.f)
+		, TurnRate(0.f)
+		, FirstWeightedIndex(INDEX_NONE)
+		, FirstWeightedTurnYaw(0.f)
+	{}
+
+	/** The animation these curves were baked from */
+	TObjectKey<UAnimSequence> Sequence;
+
+	/** Curve names these values were baked from */
+	FTurnInPlaceSettings Settings;
+
+	/** Samples per second, adjusted so the final sample lands exactly on PlayLength */
+	float SampleRate;
+
+	/** Play length of the animation when it was baked */
+	float PlayLength;
+
+	/** How far the animation turns, the absolute RemainingTurnYaw at the start of the animation */
+	float TotalTurnYaw;
+
+	/** Animation time at which RemainingTurnYaw reaches zero */
+	float TurnDuration;
+
+	/** Degrees per second the animation turns at when played at its RateScale, used by procedural turns */
+	float TurnRate;
+
+	/** First sample with any TurnYawWeight, INDEX_NONE if the animation never applies its turn */
+	int32 FirstWeightedIndex;
+
+	/** RemainingTurnYaw * TurnYawWeight at FirstWeightedIndex, where the turn starts being applied from */
+	float FirstWeightedTurnYaw;
+
+	/**
+	 * Baked curve values, the four curves for each sample are stored together so a single evaluation reads from one
+	 * cache line. Every evaluation reads all four curves, so this is preferred over a separate array per curve
+	 */
+	TArray<FTurnInPlaceCurveValues> Samples;
+
+	/**
+	 * Evaluate the baked curves, interpolating every curve between samples the same as UAnimSequence::EvaluateCurveData()
+	 * @param Time Animation time
+	 * @return The curve values at this time
+	 */
+	FTurnInPlaceCurveValues Evaluate(float Time) const
+	{
+		if (Samples.Num() == 0)
+		{
+			return {};
+		}
+
+		const float SampleTime = FMath::Clamp(Time, 0.f, PlayLength) * SampleRate;
+		const int32 Index = FMath::Clamp(FMath::FloorToInt(SampleTime), 0, Samples.Num() - 1);
+		const int32 NextIndex = FMath::Min(Index + 1, Samples.Num() - 1);
+		const float Alpha = FMath::Clamp(SampleTime - (float)Index, 0.f, 1.f);
+
+		const FTurnInPlaceCurveValues& Sample = Samples[Index];
+		const FTurnInPlaceCurveValues& NextSample = Samples[NextIndex];
+		return {
+			FMath::Lerp(Sample.RemainingTurnYaw, NextSample.RemainingTurnYaw, Alpha),
+			FMath::Lerp(Sample.TurnYawWeight, NextSample.TurnYawWeight, Alpha),
+			FMath::Lerp(Sample.PauseTurnInPlace, NextSample.PauseTurnInPlace, Alpha),
+			FMath::Lerp(Sample.LockTurnInPlace, NextSample.LockTurnInPlace, Alpha)
+		};
+	}
+
+	/**
+	 * Turn yaw applied to the turn offset between the start of the animation and Time, the same as
+	 * UTurnInPlace::TurnInPlace() accumulates it from the curve delta once TurnYawWeight becomes relevant
+	 * @param Time Animation time
+	 */
+	float GetAppliedTurnYaw(float Time) const;
+
+	bool Matches(const UAnimSequence* InSequence, const FTurnInPlaceSettings& InSettings) const;
+};
+
+typedef TSharedPtr<const FTurnInPlaceCurveTable, ESPMode::ThreadSafe> FTurnInPlaceCurveTablePtr;
+
+/**
+ * Bakes FTurnInPlaceCurveTable on demand and shares them between every TurnInPlace component that uses the same
+ * animation and curve names
+ */
+class ACTORTURNINPLACE_API FTurnInPlaceCurveTableCache
+{
+public:
+	/**
+	 * Find the baked curves for this animation, baking them if this is the first time they were requested
+	 * @param Sequence The turn animation
+	 * @param Settings The curve names to bake
+	 * @return The baked curves, or nullptr if Sequence is invalid
+	 */
+	static FTurnInPlaceCurveTablePtr FindOrBake(const UAnimSequence* Sequence, const FTurnInPlaceSettings& Settings);
+
+	/** Bake every turn animation in the anim set ahead of time, so we don't bake them mid-turn */
+	static void Prewarm(const FTurnInPlaceAnimSet& AnimSet, const FTurnInPlaceSettings& Settings);
+
+	/** Remove tables for animations that no longer exist */
+	static void PurgeStaleTables();
+
+	/** Release every table and stop purging after garbage collection, called when the module shuts down */
+	static void Shutdown();
+
+protected:
+	static FTurnInPlaceCurveTablePtr Bake(const UAnimSequence* Sequence, const FTurnInPlaceSettings& Settings);
+};
@@ -75,6 +75,23 @@ public:
 
 	UFUNCTION(BlueprintPure, Category=Animation, meta=(BlueprintThreadSafe))
 	static UAnimSequence* GetTurnInPlaceAnimation(const FTurnInPlaceAnimSet& AnimSet, const FTurnInPlaceGraphNodeData& NodeData, bool bRecovery = false);
+
+	/** Get the turn animation to play from the anim set referenced by the anim graph data, without copying the anim set */
+	UFUNCTION(BlueprintPure, Category=Animation, meta=(BlueprintThreadSafe))
+	static UAnimSequence* GetTurnInPlaceAnimationFromHandle(const FTurnInPlaceAnimSetHandle& Handle, const FTurnInPlaceGraphNodeData& NodeData, bool bRecovery = false);
+
+public:
+	/** Copy the anim set referenced by the handle. Prefer the more specific accessors where possible */
+	UFUNCTION(BlueprintPure, Category=Turn, meta=(BlueprintThreadSafe, DisplayName="Get Anim Set (Thread Safe)"))
+	static FTurnInPlaceAnimSet GetAnimSetFromHandle(const FTurnInPlaceAnimSetHandle& Handle);
+
+	/** Copy the turn in place params referenced by the handle */
+	UFUNCTION(BlueprintPure, Category=Turn, meta=(BlueprintThreadSafe, DisplayName="Get Turn In Place Params (Thread Safe)"))
+	static FTurnInPlaceParams GetParamsFromHandle(const FTurnInPlaceAnimSetHandle& Handle);
+
+	/** Copy the TurnInPlace component settings referenced by the handle */
+	UFUNCTION(BlueprintPure, Category=Turn, meta=(BlueprintThreadSafe, DisplayName="Get Turn In Place Settings (Thread Safe)"))
+	static FTurnInPlaceSettings GetSettingsFromHandle(const FTurnInPlaceAnimSetHandle& Handle);
 	
 public:
 	/**
@@ -102,6 +119,28 @@ public:
 	static void ThreadSafeUpdateTurnInPlace(const FTurnInPlaceAnimGraphData& AnimGraphData,
 		bool bCanUpdateTurnInPlace, bool bIsStrafing, FTurnInPlaceAnimGraphOutput& Output);
 
+	/**
+	 * Copy the anim graph inputs that the TurnInPlace component captured during its movement update
+	 * Safe to call from the anim worker thread, the inputs are only written on the game thread before the mesh updates its animation
+	 * Call UTurnInPlace::CaptureAnimGraphInputsIfStale() from the game thread animation update first, the movement update
+	 * doesn't capture them every frame
+	 */
+	UFUNCTION(BlueprintPure, Category=Turn, meta=(BlueprintThreadSafe, DisplayName="Get Anim Graph Inputs (Thread Safe)"))
+	static FTurnInPlaceAnimGraphInputs GetAnimGraphInputs(const UTurnInPlace* TurnInPlace);
+
+	/**
+	 * Build and process the anim graph data entirely from inputs captured on the game thread, replacing both
+	 * UpdateTurnInPlace and ThreadSafeUpdateTurnInPlace. Call from NativeThreadSafeUpdateAnimation or BlueprintThreadSafeUpdateAnimation.
+	 * Does not update the pseudo anim state, which still requires UpdateTurnInPlace unless it is batched by UTurnInPlaceWorldSubsystem
+	 * @param Inputs The inputs captured by the TurnInPlace component, @see GetAnimGraphInputs
+	 * @param AnimGraphData The anim graph data for this frame
+	 * @param bCanUpdateTurnInPlace True if the turn in place is valid, false if we should not process turn in place this frame
+	 * @param Output The processed turn in place data with necessary output values for the anim graph
+	 */
+	UFUNCTION(BlueprintCallable, Category=Turn, meta=(BlueprintThreadSafe, DisplayName="Thread Safe Update Turn In Place From Inputs"))
+	static void ThreadSafeUpdateTurnInPlaceFromInputs(const FTurnInPlaceAnimGraphInputs& Inputs,
+		FTurnInPlaceAnimGraphData& AnimGraphData, bool& bCanUpdateTurnInPlace, FTurnInPlaceAnimGraphOutput& Output);
+
 protected:
 	static void ThreadSafeUpdateTurnInPlace_Internal(const FTurnInPlaceAnimGraphData& AnimGraphData,
 		bool bCanUpdateTurnInPlace, bool bIsStrafing, FTurnInPlaceAnimGraphOutput& Output);
@@ -116,10 +155,49 @@ public:
 	UFUNCTION(BlueprintCallable, Category=Turn, meta=(BlueprintThreadSafe, DefaultToSelf="AnimInstance", DisplayName="Thread Safe Update Turn In Place Curve Values"))
 	static FTurnInPlaceCurveValues ThreadSafeUpdateTurnInPlaceCurveValues(const UAnimInstance* AnimInstance, const FTurnInPlaceAnimGraphData& AnimGraphData);
 
+	/**
+	 * Hand the curve values to the TurnInPlace component without locking, so the game thread never reads them mid-write.
+	 * Call from NativeThreadSafeUpdateAnimation or BlueprintThreadSafeUpdateAnimation after ThreadSafeUpdateTurnInPlaceCurveValues.
+	 * Once published, the component no longer queries GetTurnInPlaceCurveValues from the anim instance
+	 * @param TurnInPlace The turn in place component
+	 * @param CurveValues The curve values from ThreadSafeUpdateTurnInPlaceCurveValues
+	 */
+	UFUNCTION(BlueprintCallable, Category=Turn, meta=(BlueprintThreadSafe, DisplayName="Thread Safe Publish Turn In Place Curve Values"))
+	static void ThreadSafePublishTurnInPlaceCurveValues(UTurnInPlace* TurnInPlace, const FTurnInPlaceCurveValues& CurveValues);
+
 	/**
 	 * Call from TurnInPlace Node Update Function
+	 * The anim set is read from the anim graph data's AnimSetHandle
 	 */
 	UFUNCTION(BlueprintCallable, Category=Turn, meta=(BlueprintThreadSafe, DisplayName="Thread Safe Update Turn In Place Node"))
+	static void ThreadSafeUpdateTurnInPlaceNodeFromHandle(UPARAM(ref)FTurnInPlaceGraphNodeData& NodeData, const FTurnInPlaceAnimGraphData& AnimGraphData);
+
+	/** The AnimSet pin is ignored, the anim set is read from the anim graph data instead */
+	UE_DEPRECATED(5.5, "Use ThreadSafeUpdateTurnInPlaceNodeFromHandle(), the anim set is read from the anim graph data")
+	UFUNCTION(BlueprintCallable, Category=Turn, meta=(BlueprintThreadSafe, DeprecatedFunction, DeprecationMessage="Use the Thread Safe Update Turn In Place Node without the AnimSet pin, the anim set is read from the anim graph data"))
 	static void ThreadSafeUpdateTurnInPlaceNode(UPARAM(ref)FTurnInPlaceGraphNodeData& NodeData, const FTurnInPlaceAnimGraphData& AnimGraphData, const
 		FTurnInPlaceAnimSet& AnimSet);
+
+	/**
+	 * Advance the pseudo anim state used on dedicated servers in place of the turn in place anim graph states
+	 * Thread safe, only touches the data passed in
+	 * @param DeltaTime The delta time for this frame
+	 * @param AnimGraphData The anim graph data for this frame from UpdateAnimGraphData
+	 * @param Output The anim graph output for this frame
+	 * @param State The current pseudo anim state
+	 * @param NodeData The pseudo turn node data
+	 * @param Anim The current pseudo anim sequence
+	 */
+	static void StepPseudoAnimState(float DeltaTime, const FTurnInPlaceAnimGraphData& AnimGraphData,
+		const FTurnInPlaceAnimGraphOutput& Output, ETurnPseudoAnimState& State, FTurnInPlaceGraphNodeData& NodeData,
+		TObjectPtr<UAnimSequence>& Anim);
+
+	/**
+	 * Process the anim graph data and advance the pseudo anim state in one step, for batched pseudo anim updates
+	 * Also drives FAnimNode_TurnInPlace, so the server's pseudo anim state and the client's anim graph can't drift
+	 * @see UTurnInPlaceWorldSubsystem
+	 */
+	static void ThreadSafeUpdatePseudoAnimState(float DeltaTime, const FTurnInPlaceAnimGraphData& AnimGraphData,
+		bool bIsStrafing, FTurnInPlaceAnimGraphOutput& Output, ETurnPseudoAnimState& State,
+		FTurnInPlaceGraphNodeData& NodeData, TObjectPtr<UAnimSequence>& Anim);
 };
@@ -10,4 +10,17 @@ namespace FTurnInPlaceTags
 	ACTORTURNINPLACE_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TurnMode);
 	ACTORTURNINPLACE_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TurnMode_Movement);
 	ACTORTURNINPLACE_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TurnMode_Strafe);
+
+	/** Dense indices of the native TurnMode tags, other TurnMode tags are assigned indices after these when registered */
+	static constexpr int32 TurnModeIndex_Movement = 0;
+	static constexpr int32 TurnModeIndex_Strafe = 1;
+
+	/**
+	 * Assign a dense index to a TurnMode tag, used to look up turn angles from a flat array instead of a map
+	 * @return The index of the tag, or INDEX_NONE if the tag is not valid
+	 */
+	ACTORTURNINPLACE_API int32 RegisterTurnModeIndex(const FGameplayTag& TurnModeTag);
+
+	/** @return The dense index of a TurnMode tag, or INDEX_NONE if the tag was never registered */
+	ACTORTURNINPLACE_API int32 FindTurnModeIndex(const FGameplayTag& TurnModeTag);
 }
\ No newline at end of file
@@ -6,14 +6,19 @@
 #include "UObject/Object.h"
 #include "GameplayTagContainer.h"
 #include "TurnInPlaceTags.h"
+#include <atomic>
 #include "TurnInPlaceTypes.generated.h"
 
+class AActor;
 class UAnimSequence;
 class UAnimMontage;
+class UPackageMap;
+
+ACTORTURNINPLACE_API DECLARE_LOG_CATEGORY_EXTERN(LogTurnInPlace, Log, All);
 
 /**
  * SetActorRotation always performs a sweep even for yaw-only rotations which cannot reasonably collide
- * Use the functions using SweepHandling to improve the behaviour of SetActorRotation
+ * UTurnInPlace::RotationSweepHandling determines when the rotations it applies are swept
  */
 UENUM(BlueprintType)
 enum class ERotationSweepHandling : uint8
@@ -86,6 +91,27 @@ enum class ETurnAnimUpdateMode : uint8
 	Pseudo				UMETA(Tooltip = "Update the turn in place from pseudo-evaluation of animations"),
 };
 
+/**
+ * Where the turn in place anim set is retrieved from
+ */
+UENUM(BlueprintType)
+enum class ETurnAnimSetSource : uint8
+{
+	AnimInstance		UMETA(Tooltip = "Retrieve the anim set from the anim instance via ITurnInPlaceAnimInterface"),
+	Component			UMETA(Tooltip = "Use the anim set assigned to the TurnInPlace component. When using Pseudo mode on a dedicated server, no anim instance is required"),
+	DataAsset			UMETA(Tooltip = "Use the anim set asset assigned to the TurnInPlace component, or returned by the anim instance if none is assigned. When using Pseudo mode on a dedicated server with an asset assigned to the component, no anim instance is required"),
+};
+
+/**
+ * How often the turn in place anim set is retrieved from the anim instance
+ */
+UENUM(BlueprintType)
+enum class ETurnAnimSetCacheMode : uint8
+{
+	PerFrame			UMETA(Tooltip = "Retrieve the anim set from the anim instance at most once per frame, the snapshot is only rebuilt if it differs"),
+	Versioned			UMETA(Tooltip = "Only retrieve the anim set from the anim instance when UTurnInPlace::NotifyAnimSetChanged() is called or the anim instance changes. The anim graph must report changes to the anim set"),
+};
+
 /**
  * State of the pseudo animation evaluation
  */
@@ -107,9 +133,144 @@ enum class ETurnAnimSelectMode : uint8
 	Nearest			UMETA(Tooltip = "Get the closest matching animation (at 175.f, use 180 turn). This can result in over-stepping the turn and subsequently turning back again especially when using 45 degree increments; recommend using a min turn angle greater than the smallest animation for better results"),
 };
 
+/**
+ * How often turn in place is updated, based on relevance
+ * @see FTurnInPlaceUpdateLOD
+ */
+UENUM(BlueprintType)
+enum class ETurnUpdateTier : uint8
+{
+	Full				UMETA(Tooltip = "Update every frame"),
+	Reduced				UMETA(Tooltip = "Update at FTurnInPlaceUpdateLOD::ReducedUpdateInterval, the time between updates is accumulated and applied in the next update"),
+	Frozen				UMETA(Tooltip = "Don't update, the replicated turn offset is still applied"),
+};
+
+/**
+ * Number of bits used to replicate the turn offset to simulated proxies
+ * Quantized over the active max turn angle, rounded up to the nearest 45 degrees
+ */
+UENUM(BlueprintType)
+enum class ETurnNetPrecision : uint8
+{
+	Bits8				UMETA(DisplayName="8 Bits", Tooltip = "Approx. 1 degree steps at a 135 degree max turn angle"),
+	Bits10				UMETA(DisplayName="10 Bits", Tooltip = "Approx. 0.25 degree steps at a 135 degree max turn angle"),
+	Bits12				UMETA(DisplayName="12 Bits", Tooltip = "Approx. 0.07 degree steps at a 135 degree max turn angle"),
+	Full				UMETA(Tooltip = "16 bits over the full 360 degrees, the same as FRotator::CompressAxisToShort"),
+};
+
+/**
+ * What the server replicates to simulated proxies
+ */
+UENUM(BlueprintType)
+enum class ETurnReplicationMode : uint8
+{
+	TurnOffset			UMETA(Tooltip = "Replicate the turn offset whenever it changes, including every frame while a turn plays"),
+	TurnEvents			UMETA(Tooltip = "Replicate the turn offset while not turning, and only the start, recovery and abort of each turn while turning. Simulated proxies reconstruct the turn offset from their animation curves"),
+};
+
+/**
+ * Turn transition replicated by ETurnReplicationMode::TurnEvents
+ */
+UENUM(BlueprintType)
+enum class ETurnEventType : uint8
+{
+	None,
+	Start				UMETA(Tooltip = "A turn animation started"),
+	Recovery			UMETA(Tooltip = "The turn completed and is recovering"),
+	Abort				UMETA(Tooltip = "The turn was aborted because turn in place became unavailable"),
+};
+
+/**
+ * Precision used to replicate the turn offset to simulated proxies, optionally coarser for distant viewers
+ * A turn offset of 0 is always sent as a single bit
+ */
+USTRUCT(BlueprintType)
+struct ACTORTURNINPLACE_API FTurnInPlaceNetPrecision
+{
+	GENERATED_BODY()
+
+	FTurnInPlaceNetPrecision()
+		: Precision(ETurnNetPrecision::Bits12)
+		, bReduceForDistantViewers(true)
+		, DistantViewerDistance(3000.f)
+		, DistantPrecision(ETurnNetPrecision::Bits8)
+		, Deadband(0.5f)
+		, MaxStaleness(0.5f)
+	{}
+
+	/** Precision used for viewers within DistantViewerDistance */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn)
+	ETurnNetPrecision Precision;
+
+	/** If true, connections whose view target is beyond DistantViewerDistance receive DistantPrecision instead */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn)
+	bool bReduceForDistantViewers;
+
+	/** Distance from the connection's view target beyond which DistantPrecision is used */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn, meta=(EditCondition="bReduceForDistantViewers", ClampMin="0", UIMin="0", ForceUnits="cm"))
+	float DistantViewerDistance;
+
+	/** Precision used for viewers beyond DistantViewerDistance */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn, meta=(EditCondition="bReduceForDistantViewers"))
+	ETurnNetPrecision DistantPrecision;
+
+	/**
+	 * Changes to the turn offset smaller than this since it was last replicated are held back until MaxStaleness
+	 * Filters out sub-degree jitter from the mouse while stationary. 0 to replicate every change
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn, meta=(ClampMin="0", UIMin="0", UIMax="5", ForceUnits="deg"))
+	float Deadband;
+
+	/** Changes held back by Deadband are replicated once the turn offset hasn't been replicated for this long */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn, meta=(ClampMin="0", UIMin="0", UIMax="2", ForceUnits="s"))
+	float MaxStaleness;
+};
+
+/**
+ * Predicts the turn offset on simulated proxies between replication updates, and corrects smoothly when one arrives
+ * @see FTurnInPlaceOffsetExtrapolator
+ */
+USTRUCT(BlueprintType)
+struct ACTORTURNINPLACE_API FTurnInPlaceProxyExtrapolation
+{
+	GENERATED_BODY()
+
+	FTurnInPlaceProxyExtrapolation()
+		: bEnableExtrapolation(false)
+		, MaxExtrapolationTime(0.25f)
+		, MaxRate(720.f)
+		, CorrectionTime(0.1f)
+		, SnapThreshold(30.f)
+	{}
+
+	/**
+	 * If true, simulated proxies extrapolate and smooth the replicated turn offset instead of snapping to it
+	 * The server also sends the time each turn offset was sampled, so the rate isn't skewed by packet jitter
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn)
+	bool bEnableExtrapolation;
+
+	/** Stop extrapolating this long after the last update, so a lost update can't drift indefinitely */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn, meta=(EditCondition="bEnableExtrapolation", ClampMin="0", UIMin="0", ForceUnits="s"))
+	float MaxExtrapolationTime;
+
+	/** Maximum rate the turn offset will be extrapolated at */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn, meta=(EditCondition="bEnableExtrapolation", ClampMin="0", UIMin="0", ForceUnits="deg/s"))
+	float MaxRate;
+
+	/** Time taken to blend out the error between the predicted and replicated turn offset. 0 to snap */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn, meta=(EditCondition="bEnableExtrapolation", ClampMin="0", UIMin="0", ForceUnits="s"))
+	float CorrectionTime;
+
+	/** Errors larger than this snap to the replicated turn offset instead of correcting smoothly */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn, meta=(EditCondition="bEnableExtrapolation", ClampMin="0", UIMin="0", ForceUnits="deg"))
+	float SnapThreshold;
+};
+
 /**
  * Compressed representation of Turn in Place for replication to Simulated Proxies with significant compression
  * to reduce network bandwidth
+ * TurnOffset is retained at 16 bits for comparison, NetSerialize() quantizes it per connection, @see FTurnInPlaceNetPrecision
  */
 USTRUCT()
 struct ACTORTURNINPLACE_API FTurnInPlaceSimulatedReplication
@@ -118,16 +279,58 @@ struct ACTORTURNINPLACE_API FTurnInPlaceSimulatedReplication
 
 	FTurnInPlaceSimulatedReplication()
 		: TurnOffset(0)
+		, RangeCode(RangeCodeMax)
+		, ServerTime(0)
+		, bHasServerTime(false)
 	{}
 
 	/** Compressed turn offset */
 	UPROPERTY()
 	uint16 TurnOffset;
 
-	/** Compress the turn offset from float to short */
-	void Compress(float Angle)
+	/** Index of the 45 degree multiple that bounds the turn offset, the quantization range is (RangeCode + 1) * 45 */
+	uint8 RangeCode;
+
+	/** Server time the turn offset was sampled at in milliseconds, wraps every ~65 seconds */
+	uint16 ServerTime;
+
+	/** True if ServerTime is replicated, only required when simulated proxies extrapolate */
+	bool bHasServerTime;
+
+	/** Precision settings, only used by the server */
+	FTurnInPlaceNetPrecision NetPrecision;
+
+	/** Owner used to measure the distance to each connection's view target, only used by the server */
+	TWeakObjectPtr<const AActor> Owner;
+
+	static constexpr uint8 RangeCodeMax = 3;
+	static constexpr float RangeStep = 45.f;
+
+	/**
+	 * Compress the turn offset from float to short
+	 * @param MaxTurnAngle The active max turn angle, the range the turn offset is quantized over when replicated. 0 for 180 degrees
+	 */
+	void Compress(float Angle, float MaxTurnAngle = 0.f)
 	{
 		TurnOffset = FRotator::CompressAxisToShort(Angle);
+		const float Range = MaxTurnAngle > 0.f ? FMath::Min(MaxTurnAngle, 180.f) : 180.f;
+		RangeCode = static_cast<uint8>(FMath::Clamp(FMath::CeilToInt(Range / RangeStep) - 1, 0, RangeCodeMax));
+	}
+
+	/**
+	 * Record the server time the turn offset was sampled at
+	 * @param bSend If false the time isn't replicated, saving bandwidth when simulated proxies don't extrapolate
+	 */
+	void SetServerTime(bool bSend, double Time)
+	{
+		bHasServerTime = bSend;
+		ServerTime = bSend ? static_cast<uint16>(static_cast<uint64>(Time * 1000.0) & MAX_uint16) : 0;
+	}
+
+	/** @return Seconds elapsed between two server times, accounting for wrap around */
+	static float GetServerTimeDelta(uint16 From, uint16 To)
+	{
+		return static_cast<uint16>(To - From) / 1000.f;
 	}
 
 	/** Decompress the turn offset from short to float */
@@ -136,6 +339,86 @@ struct ACTORTURNINPLACE_API FTurnInPlaceSimulatedReplication
 		const float Decompressed = FRotator::DecompressAxisFromShort(TurnOffset);
 		return FRotator::NormalizeAxis(Decompressed);
 	}
+
+	/** @return The precision to send to the connection that owns Map */
+	ETurnNetPrecision GetPrecisionForConnection(UPackageMap* Map) const;
+
+	/** @return Range the turn offset is quantized over */
+	float GetRange() const { return (RangeCode + 1) * RangeStep; }
+
+	/** @return Precision, or Full if the turn offset exceeds the range, e.g. the turn mode changed this frame */
+	ETurnNetPrecision ResolvePrecision(ETurnNetPrecision Precision) const
+	{
+		return FMath::Abs(Decompress()) <= GetRange() ? Precision : ETurnNetPrecision::Full;
+	}
+
+	/** @return Number of bits used to send the turn offset at Precision */
+	static uint32 GetValueBits(ETurnNetPrecision Precision);
+
+	/** Quantize the angle over [-Range, Range] */
+	static uint32 QuantizeAngle(float Angle, float Range, uint32 NumBits);
+
+	/** Restore an angle quantized by QuantizeAngle() */
+	static float DequantizeAngle(uint32 Value, float Range, uint32 NumBits);
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FTurnInPlaceSimulatedReplication> : public TStructOpsTypeTraitsBase2<FTurnInPlaceSimulatedReplication>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
+
+/**
+ * Turn transition replicated to simulated proxies when using ETurnReplicationMode::TurnEvents
+ */
+USTRUCT(BlueprintType)
+struct ACTORTURNINPLACE_API FTurnInPlaceTurnEvent
+{
+	GENERATED_BODY()
+
+	FTurnInPlaceTurnEvent()
+		: EventId(0)
+		, Type(ETurnEventType::None)
+		, StepSize(0)
+		, bTurnRight(false)
+		, ServerTime(0.f)
+		, TurnOffset(0)
+	{}
+
+	/** Incremented for every event, so consecutive events of the same type still replicate */
+	UPROPERTY()
+	uint8 EventId;
+
+	/** The transition that occurred */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Turn)
+	ETurnEventType Type;
+
+	/** Step size of the turn animation selected by the server */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Turn)
+	uint8 StepSize;
+
+	/** True if the server is turning right */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Turn)
+	bool bTurnRight;
+
+	/** Server world time when the event occurred */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Turn)
+	float ServerTime;
+
+	/** Turn offset when the event occurred, compressed to short */
+	UPROPERTY()
+	uint16 TurnOffset;
+
+	/** Decompress the turn offset from short to float */
+	float GetTurnOffset() const
+	{
+		return FRotator::NormalizeAxis(FRotator::DecompressAxisFromShort(TurnOffset));
+	}
 };
 
 /**
@@ -176,6 +459,13 @@ struct ACTORTURNINPLACE_API FTurnInPlaceData
 	/** Whether the last update had a valid curve value -- used to check if becoming relevant again this frame */
 	UPROPERTY(Transient)
 	bool bLastUpdateValidCurveValue;
+
+	bool operator==(const FTurnInPlaceData& Other) const
+	{
+		return TurnOffset == Other.TurnOffset && CurveValue == Other.CurveValue && InterpOutAlpha == Other.InterpOutAlpha &&
+			bLastUpdateValidCurveValue == Other.bLastUpdateValidCurveValue;
+	}
+	bool operator!=(const FTurnInPlaceData& Other) const { return !(*this == Other); }
 };
 
 /**
@@ -226,6 +516,62 @@ struct ACTORTURNINPLACE_API FTurnInPlaceSettings
 	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Settings)
 	FName LockTurnInPlaceCurveName;
+
+	bool operator==(const FTurnInPlaceSettings& Other) const
+	{
+		return TurnYawCurveName == Other.TurnYawCurveName && TurnWeightCurveName == Other.TurnWeightCurveName &&
+			PauseTurnInPlaceCurveName == Other.PauseTurnInPlaceCurveName && LockTurnInPlaceCurveName == Other.LockTurnInPlaceCurveName;
+	}
+	bool operator!=(const FTurnInPlaceSettings& Other) const { return !(*this == Other); }
+};
+
+/**
+ * Determines the ETurnUpdateTier for a net role based on the distance from the nearest view
+ * Only affects the simulation of animation curves on simulated proxies and the pseudo anim state on the dedicated server
+ * The rotation applied by FaceRotation() and PhysicsRotation() is never throttled
+ */
+USTRUCT(BlueprintType)
+struct ACTORTURNINPLACE_API FTurnInPlaceUpdateLOD
+{
+	GENERATED_BODY()
+
+	FTurnInPlaceUpdateLOD()
+		: bEnableLOD(false)
+		, ReducedDistance(2500.f)
+		, FrozenDistance(8000.f)
+		, ReducedUpdateInterval(0.1f)
+		, bReduceWhenNotRendered(true)
+		, bProceduralTurnWhenReduced(false)
+	{}
+
+	/** If false, always update at ETurnUpdateTier::Full */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn)
+	bool bEnableLOD;
+
+	/** Beyond this distance from the nearest view we update at ETurnUpdateTier::Reduced */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn, meta=(EditCondition="bEnableLOD", UIMin="0", ClampMin="0", ForceUnits="cm"))
+	float ReducedDistance;
+
+	/** Beyond this distance from the nearest view we stop updating. Set to 0.0 to never freeze */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn, meta=(EditCondition="bEnableLOD", UIMin="0", ClampMin="0", ForceUnits="cm"))
+	float FrozenDistance;
+
+	/** Time between updates when using ETurnUpdateTier::Reduced */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn, meta=(EditCondition="bEnableLOD", UIMin="0", ClampMin="0", UIMax="1", ForceUnits="s"))
+	float ReducedUpdateInterval;
+
+	/** If true, use ETurnUpdateTier::Reduced when the mesh wasn't recently rendered, regardless of distance. Has no effect on dedicated servers */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn, meta=(EditCondition="bEnableLOD"))
+	bool bReduceWhenNotRendered;
+
+	/**
+	 * When using ETurnUpdateTier::Reduced, turn procedurally every frame instead of reading animation curves
+	 * The turn offset is consumed at the rate each turn animation turns at, selected with the same turn angles and
+	 * step sizes as the anim graph, so nothing needs to be sampled and there is no visible change in tier
+	 * @see FTurnInPlaceProceduralTurn
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Turn, meta=(EditCondition="bEnableLOD"))
+	bool bProceduralTurnWhenReduced;
 };
 
 /**
@@ -411,6 +757,179 @@ struct ACTORTURNINPLACE_API FTurnInPlaceAnimSet
 	TArray<TObjectPtr<UAnimSequence>> RightTurns;
 };
 
+/**
+ * Immutable runtime snapshot of an FTurnInPlaceAnimSet
+ * Built only when the anim set changes and shared by pointer, so the anim set doesn't need to be copied every time
+ * it is queried
+ */
+struct ACTORTURNINPLACE_API FTurnInPlaceAnimSetSnapshot
+{
+	/** Problems found with the step sizes when building the snapshot */
+	enum class EStepSizeWarning : uint8
+	{
+		None			= 0,
+		Empty			= 1 << 0,
+		Unsorted		= 1 << 1,
+		OutOfRange		= 1 << 2,
+		LeftTurnsCount	= 1 << 3,
+		RightTurnsCount	= 1 << 4,
+	};
+
+	/** Lowest step angle covered by the step lookup table: Abs(TurnOffset) + SelectOffset, where SelectOffset can be -180 */
+	static constexpr int32 StepLookupMinAngle = -180;
+
+	/** Highest step angle covered by the step lookup table: Abs(TurnOffset) + SelectOffset, where both can be 180 */
+	static constexpr int32 StepLookupMaxAngle = 360;
+
+	/** One entry per degree */
+	static constexpr int32 StepLookupSize = StepLookupMaxAngle - StepLookupMinAngle + 1;
+
+	FTurnInPlaceAnimSetSnapshot(const FTurnInPlaceAnimSet& InAnimSet, const FTurnInPlaceSettings& InSettings, uint32 InVersion);
+	UE_NONCOPYABLE(FTurnInPlaceAnimSetSnapshot);
+
+	/** The anim set this snapshot was built from */
+	const FTurnInPlaceAnimSet AnimSet;
+
+	/** Settings from the TurnInPlace component that built this snapshot */
+	const FTurnInPlaceSettings Settings;
+
+	/** Version of the anim set at the time this snapshot was built */
+	const uint32 Version;
+
+	/** Unique to this snapshot, used to detect when a snapshot has been rebuilt */
+	const uint32 SnapshotId;
+
+	/** Step size index for each degree of step angle, compiled from StepSizes, SelectMode and SelectOffset */
+	uint8 StepLookup[StepLookupSize];
+
+	/** Problems found with the step sizes, these are logged by the TurnInPlace component */
+	EStepSizeWarning StepSizeWarnings;
+
+	/** True if the step sizes are sorted from lowest to highest */
+	bool bSortedStepSizes;
+
+	/** Turn angles indexed by FTurnInPlaceTags::FindTurnModeIndex(), nullptr if the anim set has no angles for that TurnMode */
+	TArray<const FTurnInPlaceAngles*, TInlineAllocator<4>> TurnAnglesByMode;
+
+	/** FTurnInPlaceMontageHandling::IgnoreMontages as a set, so we don't search the array for every montage */
+	TSet<const UAnimMontage*> IgnoredMontages;
+
+	const FTurnInPlaceParams& GetParams() const { return AnimSet.Params; }
+
+	/** @return True if this snapshot was built from an identical anim set and settings, so it doesn't need rebuilding */
+	bool Matches(const FTurnInPlaceAnimSet& InAnimSet, const FTurnInPlaceSettings& InSettings) const;
+
+	/**
+	 * Get the turn angles for a dense TurnMode index
+	 * @param ModeIndex Index from FTurnInPlaceTags::FindTurnModeIndex()
+	 * @return The turn angles, or nullptr if the anim set has no angles for that TurnMode
+	 */
+	const FTurnInPlaceAngles* FindTurnAnglesFast(int32 ModeIndex) const
+	{
+		return TurnAnglesByMode.IsValidIndex(ModeIndex) ? TurnAnglesByMode[ModeIndex] : nullptr;
+	}
+
+	/** Get the turn angles for a TurnMode tag, prefer FindTurnAnglesFast() when the index is already known */
+	const FTurnInPlaceAngles* GetTurnAngles(const FGameplayTag& TurnModeTag) const
+	{
+		return FindTurnAnglesFast(FTurnInPlaceTags::FindTurnModeIndex(TurnModeTag));
+	}
+
+	/**
+	 * Select the step size (index into LeftTurns or RightTurns) for the given turn angle from the lookup table
+	 * @param Angle The turn offset
+	 * @param bTurnRight True if turning right
+	 * @return The step size
+	 */
+	int32 DetermineStepSize(float Angle, bool& bTurnRight) const
+	{
+		// Determine if we are turning right or left
+		bTurnRight = Angle > 0.f;
+
+		const float StepAngle = FMath::Abs(Angle) + AnimSet.Params.SelectOffset;
+		const int32 Index = FMath::Clamp<int32>(FMath::FloorToInt(StepAngle), StepLookupMinAngle, StepLookupMaxAngle) - StepLookupMinAngle;
+
+		// Nearest can change to the next step size part way through a degree
+		if (AnimSet.Params.SelectMode == ETurnAnimSelectMode::Nearest)
+		{
+			return ResolveNearestStepSize(StepLookup[Index], StepAngle);
+		}
+		return StepLookup[Index];
+	}
+
+	/**
+	 * Resolve the step size selected by the lookup table for Nearest, which is sampled at each whole degree
+	 * Compares the exact step angle against the next step size, the same as SelectStepSize()
+	 * @param StepSize The step size from the lookup table
+	 * @param StepAngle Abs(TurnOffset) + SelectOffset
+	 * @return The step size
+	 */
+	int32 ResolveNearestStepSize(int32 StepSize, float StepAngle) const;
+
+	/**
+	 * Select the step size by searching the step sizes, this is used to build the lookup table
+	 * @param Params Params containing the StepSizes and SelectMode
+	 * @param StepAngle Abs(TurnOffset) + SelectOffset
+	 * @return The step size
+	 */
+	static int32 SelectStepSize(const FTurnInPlaceParams& Params, float StepAngle);
+
+	/** Snapshot built from a default constructed anim set, used when there is no valid data */
+	static const TSharedRef<const FTurnInPlaceAnimSetSnapshot, ESPMode::ThreadSafe>& GetDefault();
+};
+
+ENUM_CLASS_FLAGS(FTurnInPlaceAnimSetSnapshot::EStepSizeWarning);
+
+typedef TSharedPtr<const FTurnInPlaceAnimSetSnapshot, ESPMode::ThreadSafe> FTurnInPlaceAnimSetSnapshotPtr;
+
+/**
+ * Thread-safe reference to an immutable anim set snapshot, passed to the anim graph instead of copying the anim set
+ * Use UTurnInPlaceStatics::GetAnimSetFromHandle() to access the anim set from blueprint
+ */
+USTRUCT(BlueprintType)
+struct ACTORTURNINPLACE_API FTurnInPlaceAnimSetHandle
+{
+	GENERATED_BODY()
+
+	FTurnInPlaceAnimSetHandle()
+	{}
+
+	FTurnInPlaceAnimSetHandle(const FTurnInPlaceAnimSetSnapshotPtr& InSnapshot)
+		: Snapshot(InSnapshot)
+	{}
+
+	bool IsValid() const { return Snapshot.IsValid(); }
+
+	/** @return The referenced snapshot, or the default snapshot if this handle is not set */
+	const FTurnInPlaceAnimSetSnapshot& Get() const
+	{
+		return Snapshot.IsValid() ? *Snapshot : *FTurnInPlaceAnimSetSnapshot::GetDefault();
+	}
+
+	const FTurnInPlaceAnimSet& GetAnimSet() const { return Get().AnimSet; }
+	const FTurnInPlaceParams& GetParams() const { return Get().GetParams(); }
+	const FTurnInPlaceSettings& GetSettings() const { return Get().Settings; }
+
+	/** Keep the animations in the referenced anim set alive while the anim graph holds onto this handle */
+	void AddStructReferencedObjects(FReferenceCollector& Collector) const;
+
+	bool operator==(const FTurnInPlaceAnimSetHandle& Other) const { return Snapshot == Other.Snapshot; }
+	bool operator!=(const FTurnInPlaceAnimSetHandle& Other) const { return Snapshot != Other.Snapshot; }
+
+protected:
+	FTurnInPlaceAnimSetSnapshotPtr Snapshot;
+};
+
+template<>
+struct TStructOpsTypeTraits<FTurnInPlaceAnimSetHandle> : public TStructOpsTypeTraitsBase2<FTurnInPlaceAnimSetHandle>
+{
+	enum
+	{
+		WithAddStructReferencedObjects = true,
+		WithIdenticalViaEquality = true,
+	};
+};
+
 /**
  * Cached in NativeThreadSafeUpdateAnimation or BlueprintThreadSafeUpdateAnimation
  * Avoid updating these out of sync with the anim graph by caching them in a consistent position thread-wise
@@ -462,6 +981,436 @@ struct ACTORTURNINPLACE_API FTurnInPlaceCurveValues
 	float LockTurnInPlace;
 };
 
+/**
+ * Double buffered seqlock that hands curve values from the anim worker thread to the game thread without locks
+ * Each publish writes the buffer the reader isn't expected to be on, so the reader only retries if the writer laps it
+ * Single writer (the anim graph update), any number of readers
+ */
+struct ACTORTURNINPLACE_API FTurnInPlaceCurveChannel
+{
+	FTurnInPlaceCurveChannel()
+		: Sequence(0)
+		, WriteSequence(0)
+		, ResetSequence(0)
+	{}
+
+	FTurnInPlaceCurveChannel(const FTurnInPlaceCurveChannel&) = delete;
+	FTurnInPlaceCurveChannel& operator=(const FTurnInPlaceCurveChannel&) = delete;
+
+	/** Publish new curve values, only ever call from one thread at a time */
+	void Publish(const FTurnInPlaceCurveValues& Values);
+
+	/**
+	 * Read the most recently published curve values
+	 * @return False if nothing has been published yet
+	 */
+	bool Read(FTurnInPlaceCurveValues& OutValues) const;
+
+	/** @return True if anything has been published since the last Reset() */
+	bool HasPublished() const
+	{
+		return static_cast<int32>(Sequence.load(std::memory_order_acquire) - ResetSequence.load(std::memory_order_acquire)) > 0;
+	}
+
+	/**
+	 * Discard the published values, e.g. when the anim instance that publishes them changes
+	 * Safe to call from any thread while a publish is in flight, the writer's sequences are left untouched. Any publish
+	 * in flight is discarded too, which can also discard the first publish after the reset
+	 */
+	void Reset();
+
+protected:
+	/** Curve values stored as atomics so a torn read is detected instead of being undefined behaviour */
+	struct FBuffer
+	{
+		FBuffer()
+			: RemainingTurnYaw(0.f)
+			, TurnYawWeight(0.f)
+			, PauseTurnInPlace(0.f)
+			, LockTurnInPlace(0.f)
+		{}
+
+		std::atomic<float> RemainingTurnYaw;
+		std::atomic<float> TurnYawWeight;
+		std::atomic<float> PauseTurnInPlace;
+		std::atomic<float> LockTurnInPlace;
+	};
+
+	FBuffer Buffers[2];
+
+	/** Number of completed publishes, the latest values are in Buffers[Sequence & 1] */
+	std::atomic<uint32> Sequence;
+
+	/** Number of started publishes, a reader of Sequence N is invalidated once this reaches N + 2 */
+	std::atomic<uint32> WriteSequence;
+
+	/** Publishes up to and including this sequence were discarded by Reset() */
+	std::atomic<uint32> ResetSequence;
+};
+
+/**
+ * Inputs and result of the last TurnInPlace() evaluation that changed nothing
+ * If the next evaluation has the same inputs it will also change nothing, so it can be skipped
+ */
+struct ACTORTURNINPLACE_API FTurnInPlaceQuiescence
+{
+	FTurnInPlaceQuiescence()
+		: DesiredYaw(0.f)
+		, CurrentYaw(0.f)
+		, TurnYawWeight(0.f)
+		, RemainingTurnYaw(0.f)
+		, EnabledState(ETurnInPlaceEnabledState::Locked)
+		, SnapshotId(0)
+		, TurnModeIndex(INDEX_NONE)
+		, bValid(false)
+	{}
+
+	float DesiredYaw;
+	float CurrentYaw;
+	float TurnYawWeight;
+	float RemainingTurnYaw;
+	ETurnInPlaceEnabledState EnabledState;
+
+	/** The anim set and turn mode determine the turn angles, TurnOffset must be re-clamped when they change */
+	uint32 SnapshotId;
+	int32 TurnModeIndex;
+
+	/** TurnData before and after the evaluation */
+	FTurnInPlaceData TurnData;
+
+	/** False if the last evaluation changed anything */
+	bool bValid;
+
+	bool Matches(float InDesiredYaw, float InCurrentYaw, const FTurnInPlaceCurveValues& CurveValues,
+		ETurnInPlaceEnabledState InEnabledState, uint32 InSnapshotId, int32 InTurnModeIndex, const FTurnInPlaceData& InTurnData) const
+	{
+		return bValid && DesiredYaw == InDesiredYaw && CurrentYaw == InCurrentYaw && EnabledState == InEnabledState &&
+			TurnYawWeight == CurveValues.TurnYawWeight && RemainingTurnYaw == CurveValues.RemainingTurnYaw &&
+			SnapshotId == InSnapshotId && TurnModeIndex == InTurnModeIndex && TurnData == InTurnData;
+	}
+};
+
+/**
+ * Accumulates the time skipped by ETurnUpdateTier::Reduced so the next update can catch up
+ */
+struct ACTORTURNINPLACE_API FTurnInPlaceUpdateThrottle
+{
+	FTurnInPlaceUpdateThrottle()
+		: AccumulatedTime(0.f)
+		, bWasFrozen(false)
+	{}
+
+	/** Time since the last update */
+	float AccumulatedTime;
+
+	/** True while frozen, cleared by the owner once it has handled resuming */
+	bool bWasFrozen;
+
+	/**
+	 * Accumulate DeltaTime and determine if we should update this frame
+	 * @param OutDeltaTime The time to update by, including any time accumulated since the last update
+	 * @return True if we should update
+	 */
+	bool Consume(ETurnUpdateTier Tier, float Interval, float DeltaTime, float& OutDeltaTime)
+	{
+		if (Tier == ETurnUpdateTier::Frozen)
+		{
+			// Frozen time is discarded, there is nothing meaningful to catch up on
+			AccumulatedTime = 0.f;
+			bWasFrozen = true;
+			return false;
+		}
+
+		AccumulatedTime += DeltaTime;
+		if (Tier == ETurnUpdateTier::Reduced && AccumulatedTime < Interval)
+		{
+			return false;
+		}
+
+		OutDeltaTime = AccumulatedTime;
+		AccumulatedTime = 0.f;
+		return true;
+	}
+};
+
+/**
+ * Extrapolates the replicated turn offset on simulated proxies
+ * The rate is determined from the last two updates, less the yaw our own curves applied in between, because the
+ * curves keep being applied locally and would otherwise be counted twice
+ */
+struct ACTORTURNINPLACE_API FTurnInPlaceOffsetExtrapolator
+{
+	FTurnInPlaceOffsetExtrapolator()
+	{
+		Reset();
+	}
+
+	float LastReceivedOffset;
+
+	/** Server time the last update was sampled at, @see FTurnInPlaceSimulatedReplication::ServerTime */
+	uint16 LastServerTime;
+	bool bHasReceived;
+
+	/** Yaw applied by our curves since the last update */
+	float CurveYawSinceReceived;
+
+	/** Rate of change that our curves don't account for, e.g. control rotation, in degrees per second */
+	float Rate;
+
+	/** Time extrapolated since the last update */
+	float ExtrapolatedTime;
+
+	/** Error that remains to be corrected */
+	float PendingCorrection;
+
+	void Reset()
+	{
+		LastReceivedOffset = 0.f;
+		LastServerTime = 0;
+		bHasReceived = false;
+		CurveYawSinceReceived = 0.f;
+		Rate = 0.f;
+		ExtrapolatedTime = 0.f;
+		PendingCorrection = 0.f;
+	}
+
+	/** Accumulate the yaw our curves applied to the turn offset */
+	void AddCurveYaw(float CurveYaw)
+	{
+		CurveYawSinceReceived += CurveYaw;
+	}
+
+	/**
+	 * Receive a replicated turn offset
+	 * @param ServerTime Server time the turn offset was sampled at, so packet jitter doesn't skew the rate
+	 * @param bHasServerTime If false the rate can't be determined and only the correction is applied
+	 * @return The turn offset to apply now, the remaining error is corrected by Step()
+	 */
+	float Receive(float ReceivedOffset, float CurrentOffset, uint16 ServerTime, bool bHasServerTime,
+		const FTurnInPlaceProxyExtrapolation& Params)
+	{
+		Rate = 0.f;
+		const float Elapsed = FTurnInPlaceSimulatedReplication::GetServerTimeDelta(LastServerTime, ServerTime);
+		if (bHasReceived && bHasServerTime && Elapsed > 0.f)
+		{
+			const float ServerDelta = FMath::FindDeltaAngleDegrees(LastReceivedOffset, ReceivedOffset);
+			Rate = FMath::Clamp((ServerDelta - CurveYawSinceReceived) / Elapsed, -Params.MaxRate, Params.MaxRate);
+		}
+
+		LastReceivedOffset = ReceivedOffset;
+		LastServerTime = ServerTime;
+		bHasReceived = true;
+		CurveYawSinceReceived = 0.f;
+		ExtrapolatedTime = 0.f;
+
+		const float Error = FMath::FindDeltaAngleDegrees(CurrentOffset, ReceivedOffset);
+		if (Params.CorrectionTime <= 0.f || FMath::Abs(Error) >= Params.SnapThreshold)
+		{
+			PendingCorrection = 0.f;
+			return ReceivedOffset;
+		}
+
+		PendingCorrection = Error;
+		return CurrentOffset;
+	}
+
+	/** @return The change to apply to the turn offset this frame */
+	float Step(float DeltaTime, const FTurnInPlaceProxyExtrapolation& Params)
+	{
+		if (!bHasReceived || DeltaTime <= 0.f)
+		{
+			return 0.f;
+		}
+
+		float Delta = 0.f;
+		if (ExtrapolatedTime < Params.MaxExtrapolationTime)
+		{
+			const float ExtrapolateTime = FMath::Min(DeltaTime, Params.MaxExtrapolationTime - ExtrapolatedTime);
+			ExtrapolatedTime += ExtrapolateTime;
+			Delta += Rate * ExtrapolateTime;
+		}
+
+		if (PendingCorrection != 0.f)
+		{
+			const float Alpha = 1.f - FMath::Exp(-DeltaTime / Params.CorrectionTime);
+			const float Correction = FMath::IsNearlyZero(PendingCorrection, 0.01f) ? PendingCorrection : PendingCorrection * Alpha;
+			PendingCorrection -= Correction;
+			Delta += Correction;
+		}
+
+		return Delta;
+	}
+};
+
+/**
+ * Turn in progress when turning procedurally instead of reading animation curves
+ * Produces the curve values the turn animation would have, so TurnInPlace() handles both identically
+ */
+struct ACTORTURNINPLACE_API FTurnInPlaceProceduralTurn
+{
+	FTurnInPlaceProceduralTurn()
+		: RemainingTurnYaw(0.f)
+		, TurnRate(0.f)
+		, bIsTurning(false)
+	{}
+
+	/** Yaw remaining to complete the turn, this has the same sign as the turn offset that started it */
+	float RemainingTurnYaw;
+
+	/** Degrees per second, derived from the turn animation's total yaw and the time it takes to turn */
+	float TurnRate;
+
+	/** True while a turn is in progress */
+	bool bIsTurning;
+
+	/** The curve values the turn animation would have at this point of the turn */
+	FTurnInPlaceCurveValues GetCurveValues() const
+	{
+		return { RemainingTurnYaw, bIsTurning ? 1.f : 0.f, 0.f, 0.f };
+	}
+};
+
+/**
+ * Everything TurnInPlace needs to know about the current frame, evaluated once and shared by FaceRotation,
+ * PhysicsRotation, TurnInPlace and UpdateAnimGraphData
+ * Keyed by GFrameCounter, so it is rebuilt the first time it is requested each frame
+ */
+struct ACTORTURNINPLACE_API FTurnInPlaceFrameContext
+{
+	FTurnInPlaceFrameContext()
+		: Frame(MAX_uint64)
+		, EnabledState(ETurnInPlaceEnabledState::Locked)
+		, TurnModeIndex(INDEX_NONE)
+		, bHasValidData(false)
+		, bProceduralTurn(false)
+	{}
+
+	/** GFrameCounter when this context was built, MAX_uint64 if it has been invalidated */
+	uint64 Frame;
+
+	/** Anim set used for this frame, never null */
+	FTurnInPlaceAnimSetSnapshotPtr Snapshot;
+
+	/** Curve values read once from the anim instance or pseudo anim */
+	FTurnInPlaceCurveValues CurveValues;
+
+	/** Enabled state after applying OverrideTurnInPlace() */
+	ETurnInPlaceEnabledState EnabledState;
+
+	/** Result of GetTurnModeTag() */
+	FGameplayTag TurnModeTag;
+
+	/** Dense index for TurnModeTag, @see FTurnInPlaceTags::FindTurnModeIndex */
+	int32 TurnModeIndex;
+
+	/** Result of HasValidData() */
+	bool bHasValidData;
+
+	/** True if CurveValues came from FTurnInPlaceProceduralTurn */
+	bool bProceduralTurn;
+
+	bool IsValidForFrame(uint64 InFrame) const { return Frame == InFrame; }
+	const FTurnInPlaceParams& GetParams() const { return Snapshot->GetParams(); }
+	const FTurnInPlaceAngles* GetTurnAngles() const { return Snapshot->FindTurnAnglesFast(TurnModeIndex); }
+	bool IsTurning() const { return bHasValidData && !FMath::IsNearlyZero(CurveValues.TurnYawWeight, KINDA_SMALL_NUMBER); }
+};
+
+/**
+ * Everything the anim graph needs from the game thread, captured by the TurnInPlace component during its movement
+ * update so the anim graph can be updated entirely from NativeThreadSafeUpdateAnimation or BlueprintThreadSafeUpdateAnimation
+ * @see UTurnInPlace::CaptureAnimGraphInputs()
+ */
+USTRUCT(BlueprintType)
+struct ACTORTURNINPLACE_API FTurnInPlaceAnimGraphInputs
+{
+	GENERATED_BODY()
+
+	FTurnInPlaceAnimGraphInputs()
+		: TurnOffset(0.f)
+		, bIsTurning(false)
+		, EnabledState(ETurnInPlaceEnabledState::Locked)
+		, TurnModeTag(FGameplayTag::EmptyTag)
+		, TurnModeIndex(INDEX_NONE)
+		, bAbortTurn(false)
+		, bWantsPseudoAnimState(false)
+		, UpdateTier(ETurnUpdateTier::Full)
+		, bProceduralTurn(false)
+		, bIsStrafing(false)
+		, bIsStationary(true)
+		, TurnEventStepSize(INDEX_NONE)
+		, bTurnEventTurnRight(false)
+		, TurnEventStartTime(0.f)
+		, bHasValidData(false)
+		, Frame(0)
+	{}
+
+	/** The anim set for this frame */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Turn)
+	FTurnInPlaceAnimSetHandle AnimSet;
+
+	/** Current turn offset */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Turn)
+	float TurnOffset;
+
+	/** True if the TurnYawWeight curve is not 0 */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Turn)
+	bool bIsTurning;
+
+	/** Enabled state after applying UTurnInPlace::OverrideTurnInPlace() */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Turn)
+	ETurnInPlaceEnabledState EnabledState;
+
+	/** Result of UTurnInPlace::GetTurnModeTag() */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Turn)
+	FGameplayTag TurnModeTag;
+
+	/** Dense index for TurnModeTag, @see FTurnInPlaceTags::FindTurnModeIndex */
+	int32 TurnModeIndex;
+
+	/** True if we are unable to turn in place and UTurnInPlace::CanAbortTurnAnimation() allows aborting the turn */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Turn)
+	bool bAbortTurn;
+
+	/** Result of UTurnInPlace::WantsPseudoAnimState() */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Turn)
+	bool bWantsPseudoAnimState;
+
+	/** Result of UTurnInPlace::GetUpdateTier(), Full unless using the pseudo anim state */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Turn)
+	ETurnUpdateTier UpdateTier;
+
+	/** True if turning procedurally */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Turn)
+	bool bProceduralTurn;
+
+	/** True if the character doesn't orient rotation to movement */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Turn)
+	bool bIsStrafing;
+
+	/** Result of UTurnInPlace::IsCharacterStationary() */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Turn)
+	bool bIsStationary;
+
+	/** Simulated proxy only, step size of a turn started by a turn event that hasn't started playing yet, INDEX_NONE if none */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Turn)
+	int32 TurnEventStepSize;
+
+	/** Simulated proxy only, direction of the turn started by a turn event */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Turn)
+	bool bTurnEventTurnRight;
+
+	/** Simulated proxy only, animation time the server has already played of the turn started by a turn event */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Turn)
+	float TurnEventStartTime;
+
+	/** Result of UTurnInPlace::HasValidData(), nothing else is valid if false */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=Turn)
+	bool bHasValidData;
+
+	/** GFrameCounter when these were captured */
+	uint64 Frame;
+};
+
 /**
  * Retrieves game thread data in NativeUpdateAnimation or BlueprintUpdate Animation
  * For processing by FTurnInPlaceAnimGraphOutput in NativeThreadSafeUpdateAnimation or BlueprintThreadSafeUpdateAnimation
@@ -481,12 +1430,27 @@ struct ACTORTURNINPLACE_API FTurnInPlaceAnimGraphData
 		, TurnModeTag(FGameplayTag::EmptyTag)
 		, bHasValidTurnAngles(false)
 		, bWantsPseudoAnimState(false)
+		, UpdateTier(ETurnUpdateTier::Full)
+		, bProceduralTurn(false)
+		, TurnStartTime(0.f)
+		, bIsStrafing(false)
 	{}
 
-	/** The current Anim Set containing the turn anims to play and turn params */
+	/**
+	 * The current Anim Set containing the turn anims to play and turn params, along with the component's settings
+	 * Use UTurnInPlaceStatics::GetAnimSetFromHandle() to access it from blueprint
+	 */
 	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Category=Turn)
+	FTurnInPlaceAnimSetHandle AnimSetHandle;
+
+	/** No longer populated, the anim set is no longer copied every frame */
+	UPROPERTY(BlueprintReadOnly, Category=Turn, meta=(DeprecatedProperty, DeprecationMessage="No longer populated. Use AnimSetHandle with GetAnimSetFromHandle() instead."))
 	FTurnInPlaceAnimSet AnimSet;
 
+	/** No longer populated, the component settings are part of the anim set snapshot */
+	UPROPERTY(BlueprintReadOnly, Category=Turn, meta=(DeprecatedProperty, DeprecationMessage="No longer populated. Use AnimSetHandle with GetSettingsFromHandle() instead."))
+	FTurnInPlaceSettings Settings;
+
 	/** Current offset for the turn in place -- this is the inverse of Epic's RootYawOffset (*= -1.0 for same result) */
 	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Category=Turn)
 	float TurnOffset;
@@ -526,13 +1490,28 @@ struct ACTORTURNINPLACE_API FTurnInPlaceAnimGraphData
 	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Category=Turn)
 	FTurnInPlaceAngles TurnAngles;
 
-	/** Cached Settings from the TurnInPlace component */
-	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Category=Turn)
-	FTurnInPlaceSettings Settings;
-
 	/** Cached result for the validity of the contained TurnAngles property */
 	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Category=Turn)
 	bool bWantsPseudoAnimState;
+
+	/** How often the pseudo anim state should be advanced, @see UTurnInPlace::GetUpdateTier() */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Category=Turn)
+	ETurnUpdateTier UpdateTier;
+
+	/** True if turning procedurally, the pseudo anim state doesn't need to be advanced */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Category=Turn)
+	bool bProceduralTurn;
+
+	/**
+	 * Animation time to start the next turn from, instead of 0
+	 * Non-zero when a simulated proxy catches up to a turn the server started before the turn event arrived
+	 */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Category=Turn)
+	float TurnStartTime;
+
+	/** True if the character is strafing, captured with the other inputs so every anim graph path agrees */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Category=Turn)
+	bool bIsStrafing;
 };
 
 /**
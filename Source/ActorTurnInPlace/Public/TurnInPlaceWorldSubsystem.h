@@ -0,0 +1,87 @@
+﻿// Copyright (c) 2025 Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TurnInPlaceTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TurnInPlaceWorldSubsystem.generated.h"
+
+class UTurnInPlace;
+
+/**
+ * Advances the pseudo anim state of every registered TurnInPlace component in a single pass each frame
+ * Components register themselves when using ETurnAnimUpdateMode::Pseudo with bBatchPseudoAnimState enabled
+ *
+ * Pseudo state is stored as parallel arrays indexed by UTurnInPlace::PseudoBatchIndex
+ * Gathering the anim graph inputs and writing the results back happens on the game thread, building the anim graph
+ * data and advancing the state machine happens in ParallelFor
+ *
+ * Also provides the view locations used to determine each component's ETurnUpdateTier
+ */
+UCLASS()
+class ACTORTURNINPLACE_API UTurnInPlaceWorldSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	/** Registered components */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UTurnInPlace>> Components;
+
+	/** Pseudo anim state for each component */
+	TArray<ETurnPseudoAnimState> States;
+
+	/** Pseudo turn node data for each component */
+	TArray<FTurnInPlaceGraphNodeData> NodeData;
+
+	/** Pseudo anim sequence for each component */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UAnimSequence>> Anims;
+
+	/** Anim graph inputs gathered this frame for each component */
+	TArray<FTurnInPlaceAnimGraphInputs> GraphInputs;
+
+	/** Anim graph output computed this frame for each component */
+	TArray<FTurnInPlaceAnimGraphOutput> Outputs;
+
+	/** True if the component had valid data when gathered this frame */
+	TArray<bool> bShouldUpdate;
+
+	/** Time to advance each component by, including any time skipped by ETurnUpdateTier::Reduced */
+	TArray<float> StepDeltaTimes;
+
+	/** View locations of every player controller, @see GetViewLocations() */
+	TArray<FVector> ViewLocations;
+
+	/** Frame ViewLocations was gathered on */
+	uint64 ViewLocationsFrame = MAX_uint64;
+
+public:
+	/** Start advancing the pseudo anim state for this component, it will no longer be advanced by the anim instance */
+	void RegisterComponent(UTurnInPlace* TurnInPlace);
+
+	/** Stop advancing the pseudo anim state for this component */
+	void UnregisterComponent(UTurnInPlace* TurnInPlace);
+
+	/** Number of registered components */
+	int32 Num() const { return Components.Num(); }
+
+	/**
+	 * View locations of every player controller, gathered the first time they are requested each frame
+	 * On a dedicated server this includes every connected player, on clients only local players
+	 */
+	const TArray<FVector>& GetViewLocations();
+
+	/** @return Squared distance from Location to the nearest view location, or MAX_flt if there are none */
+	float GetDistSqToNearestView(const FVector& Location);
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	void RemoveAtSwap(int32 Index);
+};
@@ -0,0 +1,30 @@
+// Copyright (c) 2025 Jared Taylor
+
+using UnrealBuildTool;
+
+public class ActorTurnInPlaceGraph : ModuleRules
+{
+	public ActorTurnInPlaceGraph(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"AnimGraph",
+				"ActorTurnInPlace",
+			}
+			);
+			
+		
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"CoreUObject",
+				"Engine",
+				"BlueprintGraph",
+			}
+			);
+	}
+}
@@ -0,0 +1,17 @@
+// Copyright (c) 2025 Jared Taylor
+
+#include "ActorTurnInPlaceGraph.h"
+
+#define LOCTEXT_NAMESPACE "FActorTurnInPlaceGraphModule"
+
+void FActorTurnInPlaceGraphModule::StartupModule()
+{
+}
+
+void FActorTurnInPlaceGraphModule::ShutdownModule()
+{
+}
+
+#undef LOCTEXT_NAMESPACE
+	
+IMPLEMENT_MODULE(FActorTurnInPlaceGraphModule, ActorTurnInPlaceGraph)
@@ -0,0 +1,30 @@
+﻿// Copyright (c) 2025 Jared Taylor
+
+
+#include "AnimGraphNode_TurnInPlace.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AnimGraphNode_TurnInPlace)
+
+#define LOCTEXT_NAMESPACE "AnimGraphNode_TurnInPlace"
+
+FText UAnimGraphNode_TurnInPlace::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	return LOCTEXT("NodeTitle", "Turn In Place");
+}
+
+FText UAnimGraphNode_TurnInPlace::GetTooltipText() const
+{
+	return LOCTEXT("NodeTooltip", "Selects, plays and recovers from turn in place animations natively. Replaces the Idle, TurnInPlace and Recovery states, using the same state logic as the dedicated server's pseudo anim state.");
+}
+
+FLinearColor UAnimGraphNode_TurnInPlace::GetNodeTitleColor() const
+{
+	return FLinearColor(0.7f, 0.7f, 0.7f);
+}
+
+FString UAnimGraphNode_TurnInPlace::GetNodeCategory() const
+{
+	return TEXT("Animation|Turn In Place");
+}
+
+#undef LOCTEXT_NAMESPACE
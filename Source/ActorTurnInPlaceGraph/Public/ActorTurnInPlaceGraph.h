@@ -0,0 +1,14 @@
+// Copyright (c) 2025 Jared Taylor
+
+#pragma once
+
+#include "Modules/ModuleManager.h"
+
+class FActorTurnInPlaceGraphModule : public IModuleInterface
+{
+public:
+
+	/** IModuleInterface implementation */
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+};
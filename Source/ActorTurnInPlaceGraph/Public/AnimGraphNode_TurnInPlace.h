@@ -0,0 +1,32 @@
+﻿// Copyright (c) 2025 Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AnimGraphNode_Base.h"
+#include "AnimNode_TurnInPlace.h"
+#include "AnimGraphNode_TurnInPlace.generated.h"
+
+/**
+ * Editor node for FAnimNode_TurnInPlace
+ */
+UCLASS()
+class ACTORTURNINPLACEGRAPH_API UAnimGraphNode_TurnInPlace : public UAnimGraphNode_Base
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, Category=Settings)
+	FAnimNode_TurnInPlace Node;
+
+public:
+	// UEdGraphNode interface
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual FText GetTooltipText() const override;
+	virtual FLinearColor GetNodeTitleColor() const override;
+	// End of UEdGraphNode interface
+
+	// UAnimGraphNode_Base interface
+	virtual FString GetNodeCategory() const override;
+	// End of UAnimGraphNode_Base interface
+};